@@ -57,7 +57,20 @@ function(build_pele_exe pele_exe_name pele_physics_lib_name)
        ${SRC_DIR}/PeleLMeX_Tagging.cpp
        ${SRC_DIR}/PeleLMeX_BPatch.H
        ${SRC_DIR}/PeleLMeX_BPatch.cpp
+       ${SRC_DIR}/PeleLMeX_Statistics.cpp
        ${SRC_DIR}/PeleLMeX_Temporals.cpp
+       ${SRC_DIR}/PeleLMeX_TemporalFile.H
+       ${SRC_DIR}/PeleLMeX_TemporalFile.cpp
+       ${SRC_DIR}/PeleLMeX_PerfTrace.H
+       ${SRC_DIR}/PeleLMeX_PerfTrace.cpp
+       ${SRC_DIR}/PeleLMeX_ComputeLayout.H
+       ${SRC_DIR}/PeleLMeX_ComputeLayout.cpp
+       ${SRC_DIR}/PeleLMeX_NodeLoadBalance.H
+       ${SRC_DIR}/PeleLMeX_NodeLoadBalance.cpp
+       ${SRC_DIR}/PeleLMeX_Sampler.H
+       ${SRC_DIR}/PeleLMeX_Sampler.cpp
+       ${SRC_DIR}/PeleLMeX_AggregatedIO.H
+       ${SRC_DIR}/PeleLMeX_AggregatedIO.cpp
        ${SRC_DIR}/PeleLMeX_Timestep.cpp
        ${SRC_DIR}/PeleLMeX_TransportProp.cpp
        ${SRC_DIR}/PeleLMeX_UMac.cpp
@@ -17,6 +17,7 @@ PeleLM::Advance(int is_initIter)
 
   // Start timing current time step
   Real strt_time = ParallelDescriptor::second();
+  m_perfTrace.reset();
 
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::setup", PLM_SETUP);
@@ -159,10 +160,7 @@ PeleLM::Advance(int is_initIter)
   //----------------------------------------------------------------
   // Scalar advance
   if (m_incompressible != 0) {
-    Real MACStart = 0.0;
-    if (m_verbose > 1) {
-      MACStart = ParallelDescriptor::second();
-    }
+    Real MACStart = ParallelDescriptor::second();
 
     // Still need to get face velocities ...
     predictVelocity(advData);
@@ -170,8 +168,9 @@ PeleLM::Advance(int is_initIter)
     // ... and MAC-project face velocities, but no divu
     macProject(AmrOldTime, advData, {});
 
+    Real MACEnd = ParallelDescriptor::second() - MACStart;
+    m_perfTrace.addStageTime(PerfTrace::MAC, MACEnd);
     if (m_verbose > 1) {
-      Real MACEnd = ParallelDescriptor::second() - MACStart;
       ParallelDescriptor::ReduceRealMax(
         MACEnd, ParallelDescriptor::IOProcessorNumber());
       amrex::Print() << "   - Advance()::MACProjection()  --> Time: " << MACEnd
@@ -182,8 +181,43 @@ PeleLM::Advance(int is_initIter)
   } else {
 
     // SDC iterations
+    // In adaptive mode, every iteration past sdc_iterMin can be the last:
+    // keep the balance fluxes accumulated before the SDC iterations to
+    // restart from them if another iteration is needed
+    auto domainMassFlux = m_domainMassFlux;
+    auto domainRhoHFlux = m_domainRhoHFlux;
+    auto domainRhoYFlux = m_domainRhoYFlux;
+    Vector<MultiFab> sdcPrevState;
     for (int sdc_iter = 1; sdc_iter <= m_nSDCmax; ++sdc_iter) {
+      const bool checkConv =
+        (m_sdcAdaptive != 0) && sdc_iter > 1 && sdc_iter >= m_nSDCmin;
+      if (m_sdcAdaptive != 0 && sdc_iter > 1) {
+        m_domainMassFlux = domainMassFlux;
+        m_domainRhoHFlux = domainRhoHFlux;
+        m_domainRhoYFlux = domainRhoYFlux;
+      }
+      if (checkConv) {
+        // Store rhoY, rhoH and T at t^{n+1,k-1}
+        sdcPrevState.resize(finest_level + 1);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          sdcPrevState[lev].define(
+            grids[lev], dmap[lev], NUM_SPECIES + 2, 0, MFInfo(), Factory(lev));
+          MultiFab::Copy(
+            sdcPrevState[lev], m_leveldata_new[lev]->state, FIRSTSPEC, 0,
+            NUM_SPECIES + 2, 0);
+        }
+      }
+
       oneSDC(sdc_iter, advData, diffData);
+      m_nSDCdone = sdc_iter;
+
+      if (checkConv && sdc_iter < m_nSDCmax && sdcConverged(sdcPrevState)) {
+        break;
+      }
+    }
+    if ((m_sdcAdaptive != 0) && (m_verbose > 0)) {
+      amrex::Print() << "   Adaptive SDC: " << m_nSDCdone
+                     << " iteration(s) performed \n";
     }
 
     // Post SDC
@@ -210,10 +244,7 @@ PeleLM::Advance(int is_initIter)
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::velocity", PLM_VEL);
   // Velocity advance
-  Real VelAdvStart = 0.0;
-  if (m_verbose > 1) {
-    VelAdvStart = ParallelDescriptor::second();
-  }
+  Real VelAdvStart = ParallelDescriptor::second();
   // Re-evaluate viscosity only if scalar updated
   if (m_incompressible == 0) {
     calcViscosity(AmrNewTime);
@@ -233,8 +264,9 @@ PeleLM::Advance(int is_initIter)
   // Nodal projection to get constrained U^{np1} and new pressure \pi^{n+1/2}
   const TimeStamp rhoTime = AmrHalfTime;
   velocityProjection(is_initIter, rhoTime, m_dt);
+  Real VelAdvEnd = ParallelDescriptor::second() - VelAdvStart;
+  m_perfTrace.addStageTime(PerfTrace::Velocity, VelAdvEnd);
   if (m_verbose > 1) {
-    Real VelAdvEnd = ParallelDescriptor::second() - VelAdvStart;
     ParallelDescriptor::ReduceRealMax(
       VelAdvEnd, ParallelDescriptor::IOProcessorNumber());
     amrex::Print() << "   - Advance()::VelocityAdvance  --> Time: " << VelAdvEnd
@@ -252,14 +284,97 @@ PeleLM::Advance(int is_initIter)
   //----------------------------------------------------------------
   // Wrapup advance
   // Timing current time step
+  Real run_time = ParallelDescriptor::second() - strt_time;
+  m_perfTrace.addStageTime(PerfTrace::Advance, run_time);
+  m_avgStepTime = (m_avgStepTime > 0.0)
+                    ? 0.8 * m_avgStepTime + 0.2 * run_time
+                    : run_time;
   if (m_verbose > 0) {
-    Real run_time = ParallelDescriptor::second() - strt_time;
     ParallelDescriptor::ReduceRealMax(
       run_time, ParallelDescriptor::IOProcessorNumber());
     amrex::Print() << " >> PeleLMeX::Advance() --> Time: " << run_time << "\n";
   }
 }
 
+bool
+PeleLM::isBalanceSDCIter() const
+{
+  // In adaptive mode the last iteration is not known in advance: balance
+  // fluxes are accumulated at every iteration and reset by Advance
+  return (m_sdcIter == m_nSDCmax) ||
+         ((m_sdcAdaptive != 0) && (m_sdcIter >= m_nSDCmin));
+}
+
+bool
+PeleLM::sdcConverged(const Vector<MultiFab>& a_prevState)
+{
+  BL_PROFILE("PeleLMeX::sdcConverged()");
+
+  // Change in rhoY, rhoH and T between SDC iterates
+  Vector<MultiFab> sdcDelta(finest_level + 1);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    sdcDelta[lev].define(
+      grids[lev], dmap[lev], NUM_SPECIES + 2, 0, MFInfo(), Factory(lev));
+    MultiFab::LinComb(
+      sdcDelta[lev], 1.0, m_leveldata_new[lev]->state, FIRSTSPEC, -1.0,
+      a_prevState[lev], 0, 0, NUM_SPECIES + 2, 0);
+  }
+  Vector<Real> deltaMin, deltaMax, stateMin, stateMax;
+  MLminmax(
+    GetVecOfConstPtrs(sdcDelta), 0, NUM_SPECIES + 2, deltaMin, deltaMax);
+  MLminmax(
+    GetVecOfConstPtrs(getStateVect(AmrNewTime)), DENSITY, NUM_SPECIES + 3,
+    stateMin, stateMax);
+
+  // Scale species change by density (i.e. mass fraction change),
+  // rhoH and T change by their own magnitude
+  auto absMax = [](Real a_min, Real a_max) {
+    return std::max(std::abs(a_min), std::abs(a_max));
+  };
+  Real rhoScale = std::max(absMax(stateMin[0], stateMax[0]), 1.0e-20);
+  Real errY = 0.0;
+  for (int n = 0; n < NUM_SPECIES; ++n) {
+    errY = std::max(errY, absMax(deltaMin[n], deltaMax[n]) / rhoScale);
+  }
+  Real errH = absMax(deltaMin[NUM_SPECIES], deltaMax[NUM_SPECIES]) /
+              std::max(
+                absMax(stateMin[1 + NUM_SPECIES], stateMax[1 + NUM_SPECIES]),
+                1.0e-20);
+  Real errT = absMax(deltaMin[NUM_SPECIES + 1], deltaMax[NUM_SPECIES + 1]) /
+              std::max(
+                absMax(stateMin[2 + NUM_SPECIES], stateMax[2 + NUM_SPECIES]),
+                1.0e-20);
+
+  // The pressure drift of the current iterate, relative to divU, is the
+  // residual of the divU constraint
+  m_sdcDivuResidual = 0.0;
+  if (m_has_divu != 0) {
+    Vector<MultiFab> dPdt(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      dPdt[lev].define(grids[lev], dmap[lev], 1, 0, MFInfo(), Factory(lev));
+    }
+    calc_dPdt(AmrNewTime, GetVecOfPtrs(dPdt));
+    Vector<Real> dPdtMin, dPdtMax, divuMin, divuMax;
+    MLminmax(GetVecOfConstPtrs(dPdt), 0, 1, dPdtMin, dPdtMax);
+    MLminmax(
+      GetVecOfConstPtrs(getDivUVect(AmrNewTime)), 0, 1, divuMin, divuMax);
+    m_sdcDivuResidual = absMax(dPdtMin[0], dPdtMax[0]) /
+                        std::max(absMax(divuMin[0], divuMax[0]), 1.0e-20);
+  }
+
+  bool converged = errY < m_sdcTol && errH < m_sdcTol && errT < m_sdcTol &&
+                   m_sdcDivuResidual < m_sdcDivuTol;
+
+  if (m_verbose > 1) {
+    amrex::Print() << "   - SDC convergence: dY " << errY << ", drhoH " << errH
+                   << ", dT " << errT << ", divU residual "
+                   << m_sdcDivuResidual << (converged ? " -> converged" : "")
+                   << "\n";
+  }
+
+  return converged;
+}
+
 void
 PeleLM::oneSDC(
   int sdcIter,
@@ -279,10 +394,7 @@ PeleLM::oneSDC(
   // At the first SDC, we already copied old -> new
   if (sdcIter > 1) {
 
-    Real UpdateStart = 0.0;
-    if (m_verbose > 1) {
-      UpdateStart = ParallelDescriptor::second();
-    }
+    Real UpdateStart = ParallelDescriptor::second();
     // fillpatch the new state
     averageDownScalars(AmrNewTime);
     fillPatchState(AmrNewTime);
@@ -304,8 +416,9 @@ PeleLM::oneSDC(
     // Check divU dt based on NewTime
     checkDt(AmrNewTime, m_dt);
 
+    Real UpdateEnd = ParallelDescriptor::second() - UpdateStart;
+    m_perfTrace.addStageTime(PerfTrace::Update, UpdateEnd);
     if (m_verbose > 1) {
-      Real UpdateEnd = ParallelDescriptor::second() - UpdateStart;
       ParallelDescriptor::ReduceRealMax(
         UpdateEnd, ParallelDescriptor::IOProcessorNumber());
       amrex::Print() << "   - oneSDC()::Update t^{n+1,k}  --> Time: "
@@ -318,10 +431,7 @@ PeleLM::oneSDC(
   // Get u MAC
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::mac", PLM_MAC);
-  Real MACStart = 0.0;
-  if (m_verbose > 1) {
-    MACStart = ParallelDescriptor::second();
-  }
+  Real MACStart = ParallelDescriptor::second();
   // Predict face velocity with Godunov
   predictVelocity(advData);
 
@@ -333,8 +443,9 @@ PeleLM::oneSDC(
 
   // MAC projection
   macProject(AmrOldTime, advData, GetVecOfPtrs(advData->mac_divu));
+  Real MACEnd = ParallelDescriptor::second() - MACStart;
+  m_perfTrace.addStageTime(PerfTrace::MAC, MACEnd);
   if (m_verbose > 1) {
-    Real MACEnd = ParallelDescriptor::second() - MACStart;
     ParallelDescriptor::ReduceRealMax(
       MACEnd, ParallelDescriptor::IOProcessorNumber());
     amrex::Print() << "   - oneSDC()::MACProjection()   --> Time: " << MACEnd
@@ -348,10 +459,7 @@ PeleLM::oneSDC(
   // Scalar advections
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::scalars_adv", PLM_SADV);
-  Real ScalAdvStart = 0.0;
-  if (m_verbose > 1) {
-    ScalAdvStart = ParallelDescriptor::second();
-  }
+  Real ScalAdvStart = ParallelDescriptor::second();
 #ifdef PELE_USE_SOOT
   // Compute and update passive advective terms
   computePassiveAdvTerms(advData, FIRSTSOOT, NUMSOOTVAR);
@@ -366,8 +474,9 @@ PeleLM::oneSDC(
   // Compute \rho^{np1,k+1} and fillpatch new density
   updateDensity(advData);
   fillPatchDensity(AmrNewTime);
+  Real ScalAdvEnd = ParallelDescriptor::second() - ScalAdvStart;
+  m_perfTrace.addStageTime(PerfTrace::ScalarAdv, ScalAdvEnd);
   if (m_verbose > 1) {
-    Real ScalAdvEnd = ParallelDescriptor::second() - ScalAdvStart;
     ParallelDescriptor::ReduceRealMax(
       ScalAdvEnd, ParallelDescriptor::IOProcessorNumber());
     amrex::Print() << "   - oneSDC()::ScalarAdvection() --> Time: "
@@ -381,17 +490,15 @@ PeleLM::oneSDC(
   // Scalar diffusion
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::diffusion", PLM_DIFF);
-  Real ScalDiffStart = 0.0;
-  if (m_verbose > 1) {
-    ScalDiffStart = ParallelDescriptor::second();
-  }
+  Real ScalDiffStart = ParallelDescriptor::second();
   // Get scalar diffusion SDC RHS (stored in Forcing)
   getScalarDiffForce(advData, diffData);
 
   // Diffuse scalars
   differentialDiffusionUpdate(advData, diffData);
+  Real ScalDiffEnd = ParallelDescriptor::second() - ScalDiffStart;
+  m_perfTrace.addStageTime(PerfTrace::ScalarDiff, ScalDiffEnd);
   if (m_verbose > 1) {
-    Real ScalDiffEnd = ParallelDescriptor::second() - ScalDiffStart;
     ParallelDescriptor::ReduceRealMax(
       ScalDiffEnd, ParallelDescriptor::IOProcessorNumber());
     amrex::Print() << "   - oneSDC()::ScalarDiffusion() --> Time: "
@@ -412,17 +519,15 @@ PeleLM::oneSDC(
   // Reaction
   //----------------------------------------------------------------
   BL_PROFILE_VAR("PeleLMeX::advance::reactions", PLM_REAC);
-  Real ScalReacStart = 0.0;
-  if (m_verbose > 1) {
-    ScalReacStart = ParallelDescriptor::second();
-  }
+  Real ScalReacStart = ParallelDescriptor::second();
   // Get external forcing for chemistry
   getScalarReactForce(advData);
 
   // Integrate chemistry
   advanceChemistry(advData);
+  Real ScalReacEnd = ParallelDescriptor::second() - ScalReacStart;
+  m_perfTrace.addStageTime(PerfTrace::Reaction, ScalReacEnd);
   if (m_verbose > 1) {
-    Real ScalReacEnd = ParallelDescriptor::second() - ScalReacStart;
     ParallelDescriptor::ReduceRealMax(
       ScalReacEnd, ParallelDescriptor::IOProcessorNumber());
     amrex::Print() << "   - oneSDC()::ScalarReaction()  --> Time: "
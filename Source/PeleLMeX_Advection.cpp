@@ -651,7 +651,7 @@ PeleLM::computeScalarAdvTerms(std::unique_ptr<AdvanceAdvData>& advData)
   //----------------------------------------------------------------
   // If balances are required, compute face domain integrals
   // using level 0 since we've averaged down the fluxes already
-  if (m_sdcIter == m_nSDCmax) {
+  if (isBalanceSDCIter()) {
     if (m_do_massBalance != 0) {
       addMassFluxes(GetArrOfConstPtrs(fluxes[0]), geom[0]);
     }
@@ -0,0 +1,254 @@
+#include <PeleLMeX_AggregatedIO.H>
+#include <AMReX_VisMF.H>
+#include <AMReX_Utility.H>
+
+#include <algorithm>
+#include <climits>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace amrex;
+
+namespace {
+// Serialize a FAB as VisMF does (FAB header followed by the data in the
+// current FAB format) and compute the min/max of its valid region
+void
+serializeFab(
+  const FArrayBox& a_fab,
+  const Box& a_valid,
+  std::string& a_bytes,
+  Real* a_min,
+  Real* a_max)
+{
+  const int ncomp = a_fab.nComp();
+#ifdef AMREX_USE_GPU
+  FArrayBox hostFab(a_fab.box(), ncomp, The_Pinned_Arena());
+  hostFab.copy<RunOn::Device>(a_fab, a_fab.box(), 0, a_fab.box(), 0, ncomp);
+  Gpu::streamSynchronize();
+#else
+  const FArrayBox& hostFab = a_fab;
+#endif
+  const FABio& fabio = FArrayBox::getFABio();
+  std::ostringstream os;
+  fabio.write_header(os, hostFab, ncomp);
+  fabio.write(os, hostFab, 0, ncomp);
+  a_bytes = os.str();
+  for (int n = 0; n < ncomp; ++n) {
+    a_min[n] = hostFab.min<RunOn::Host>(a_valid, n);
+    a_max[n] = hostFab.max<RunOn::Host>(a_valid, n);
+  }
+}
+} // namespace
+
+NodeAggregatedWriter::NodeAggregatedWriter()
+{
+#ifdef AMREX_USE_MPI
+  MPI_Comm comm = ParallelDescriptor::Communicator();
+  const int myProc = ParallelDescriptor::MyProc();
+  MPI_Comm_split_type(
+    comm, MPI_COMM_TYPE_SHARED, myProc, MPI_INFO_NULL, &m_nodeComm);
+  MPI_Comm_rank(m_nodeComm, &m_nodeRank);
+  MPI_Comm_size(m_nodeComm, &m_nodeSize);
+
+  // Number the nodes in the order of their leader rank
+  int isLeader = (m_nodeRank == 0) ? 1 : 0;
+  int nodeId = 0;
+  MPI_Exscan(&isLeader, &nodeId, 1, MPI_INT, MPI_SUM, comm);
+  if (myProc == 0) {
+    nodeId = 0;
+  }
+  MPI_Bcast(&nodeId, 1, MPI_INT, 0, m_nodeComm);
+  m_nodeId = nodeId;
+#endif
+}
+
+NodeAggregatedWriter::~NodeAggregatedWriter()
+{
+  wait();
+#ifdef AMREX_USE_MPI
+  int finalized = 0;
+  MPI_Finalized(&finalized);
+  if ((finalized == 0) && m_nodeComm != MPI_COMM_NULL) {
+    MPI_Comm_free(&m_nodeComm);
+  }
+#endif
+}
+
+void
+NodeAggregatedWriter::setStaging(const std::string& a_dir, bool a_async)
+{
+  m_stageDir = a_dir;
+  m_asyncDrain = a_async;
+  if (!m_stageDir.empty() && m_nodeRank == 0) {
+    if (!amrex::UtilCreateDirectory(m_stageDir, 0755)) {
+      amrex::CreateDirectoryFailed(m_stageDir);
+    }
+  }
+}
+
+void
+NodeAggregatedWriter::write(const MultiFab& a_mf, const std::string& a_mfName)
+{
+  BL_PROFILE("NodeAggregatedWriter::write()");
+
+  const int ncomp = a_mf.nComp();
+  const int nfabs = static_cast<int>(a_mf.size());
+  const std::string baseName = a_mfName.substr(a_mfName.find_last_of('/') + 1);
+  const std::string fileName = amrex::Concatenate(a_mfName + "_D_", m_nodeId, 5);
+
+  Vector<Long> offsets(nfabs, 0);
+  Vector<int> fabNode(nfabs, 0);
+  Vector<Real> fabMin(static_cast<Long>(nfabs) * ncomp, 0.0);
+  Vector<Real> fabMax(static_cast<Long>(nfabs) * ncomp, 0.0);
+  std::string bytes;
+
+  if (m_nodeRank == 0) {
+    // Node leader: write its own FABs then those of the node ranks
+    std::string outName = fileName;
+    if (!m_stageDir.empty()) {
+      std::string stagedName = fileName;
+      std::replace(stagedName.begin(), stagedName.end(), '/', '_');
+      outName = m_stageDir + "/" + stagedName;
+      m_staged.emplace_back(outName, fileName);
+    }
+    std::ofstream ofs(
+      outName.c_str(),
+      std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+    if (!ofs.good()) {
+      amrex::FileOpenFailed(outName);
+    }
+    Long pos = 0;
+    for (MFIter mfi(a_mf); mfi.isValid(); ++mfi) {
+      const int i = mfi.index();
+      serializeFab(
+        a_mf[mfi], mfi.validbox(), bytes, &fabMin[static_cast<Long>(i) * ncomp],
+        &fabMax[static_cast<Long>(i) * ncomp]);
+      offsets[i] = pos;
+      fabNode[i] = m_nodeId;
+      ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+      pos += static_cast<Long>(bytes.size());
+    }
+#ifdef AMREX_USE_MPI
+    for (int r = 1; r < m_nodeSize; ++r) {
+      int nLocal = 0;
+      MPI_Recv(&nLocal, 1, MPI_INT, r, 0, m_nodeComm, MPI_STATUS_IGNORE);
+      for (int f = 0; f < nLocal; ++f) {
+        long long fabInfo[2] = {0, 0};
+        MPI_Recv(
+          fabInfo, 2, MPI_LONG_LONG, r, 1, m_nodeComm, MPI_STATUS_IGNORE);
+        bytes.resize(static_cast<std::size_t>(fabInfo[1]));
+        MPI_Recv(
+          bytes.data(), static_cast<int>(fabInfo[1]), MPI_BYTE, r, 2,
+          m_nodeComm, MPI_STATUS_IGNORE);
+        offsets[fabInfo[0]] = pos;
+        ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        pos += static_cast<Long>(bytes.size());
+      }
+    }
+#endif
+    ofs.flush();
+    if (!ofs.good()) {
+      amrex::Abort("Failed to write aggregated data to " + outName);
+    }
+  } else {
+#ifdef AMREX_USE_MPI
+    // Node rank: funnel the FABs to the leader, one at a time
+    int nLocal = a_mf.local_size();
+    MPI_Send(&nLocal, 1, MPI_INT, 0, 0, m_nodeComm);
+    for (MFIter mfi(a_mf); mfi.isValid(); ++mfi) {
+      const int i = mfi.index();
+      serializeFab(
+        a_mf[mfi], mfi.validbox(), bytes, &fabMin[static_cast<Long>(i) * ncomp],
+        &fabMax[static_cast<Long>(i) * ncomp]);
+      fabNode[i] = m_nodeId;
+      AMREX_ALWAYS_ASSERT(bytes.size() < static_cast<std::size_t>(INT_MAX));
+      long long fabInfo[2] = {i, static_cast<long long>(bytes.size())};
+      MPI_Send(fabInfo, 2, MPI_LONG_LONG, 0, 1, m_nodeComm);
+      MPI_Send(
+        bytes.data(), static_cast<int>(bytes.size()), MPI_BYTE, 0, 2,
+        m_nodeComm);
+    }
+#endif
+  }
+
+  // Gather the FABs location and min/max on the IO processor
+  const int ioProc = ParallelDescriptor::IOProcessorNumber();
+  ParallelDescriptor::ReduceLongSum(offsets.data(), nfabs, ioProc);
+  ParallelDescriptor::ReduceIntSum(fabNode.data(), nfabs, ioProc);
+  ParallelDescriptor::ReduceRealSum(
+    fabMin.data(), static_cast<int>(fabMin.size()), ioProc);
+  ParallelDescriptor::ReduceRealSum(
+    fabMax.data(), static_cast<int>(fabMax.size()), ioProc);
+
+  if (ParallelDescriptor::IOProcessor()) {
+    VisMF::Header hdr;
+    hdr.m_vers = VisMF::Header::Version_v1;
+    hdr.m_how = VisMF::NFiles;
+    hdr.m_ncomp = ncomp;
+    hdr.m_ngrow = a_mf.nGrowVect();
+    hdr.m_ba = a_mf.boxArray();
+    hdr.m_fod.resize(nfabs);
+    hdr.m_min.resize(nfabs, Vector<Real>(ncomp));
+    hdr.m_max.resize(nfabs, Vector<Real>(ncomp));
+    for (int i = 0; i < nfabs; ++i) {
+      hdr.m_fod[i] = VisMF::FabOnDisk(
+        amrex::Concatenate(baseName + "_D_", fabNode[i], 5), offsets[i]);
+      for (int n = 0; n < ncomp; ++n) {
+        hdr.m_min[i][n] = fabMin[static_cast<Long>(i) * ncomp + n];
+        hdr.m_max[i][n] = fabMax[static_cast<Long>(i) * ncomp + n];
+      }
+    }
+    const std::string hdrName = a_mfName + "_H";
+    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+    std::ofstream hdrFile;
+    hdrFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+    hdrFile.open(hdrName.c_str(), std::ofstream::out | std::ofstream::trunc);
+    if (!hdrFile.good()) {
+      amrex::FileOpenFailed(hdrName);
+    }
+    hdrFile << hdr;
+  }
+}
+
+void
+NodeAggregatedWriter::drain()
+{
+  if (m_stageDir.empty()) {
+    return;
+  }
+
+  BL_PROFILE("NodeAggregatedWriter::drain()");
+
+  wait();
+  auto doDrain = [staged = std::move(m_staged)]() {
+    for (const auto& [from, to] : staged) {
+      std::error_code ec;
+      std::filesystem::copy_file(
+        from, to, std::filesystem::copy_options::overwrite_existing, ec);
+      if (ec) {
+        std::cerr << "Failed to drain " << from << " to " << to << ": "
+                  << ec.message() << std::endl;
+        continue;
+      }
+      std::filesystem::remove(from, ec);
+    }
+  };
+  m_staged.clear();
+
+  if (m_asyncDrain) {
+    m_drainThread = std::thread(doDrain);
+  } else {
+    doDrain();
+    ParallelDescriptor::Barrier();
+  }
+}
+
+void
+NodeAggregatedWriter::wait()
+{
+  if (m_drainThread.joinable()) {
+    m_drainThread.join();
+  }
+}
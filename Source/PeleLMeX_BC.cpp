@@ -733,6 +733,37 @@ PeleLM::fillpatch_chemFunctCall(
   }
 }
 
+// Fill the statistics accumulators, always conservatively interpolated
+void
+PeleLM::fillpatch_stats(
+  int lev, const amrex::Real a_time, amrex::MultiFab& a_stats, int nGhost)
+{
+  ProbParm const* lprobparm = prob_parm_d;
+  const int ncomp = a_stats.nComp();
+  Vector<BCRec> bcrec_stats(ncomp, m_bcrec_force[0]);
+  if (lev == 0) {
+    PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> bndry_func(
+      geom[lev], bcrec_stats, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+    FillPatchSingleLevel(
+      a_stats, IntVect(nGhost), a_time, {m_stats[lev].get()}, {a_time}, 0, 0,
+      ncomp, geom[lev], bndry_func, 0);
+  } else {
+
+    // Interpolator
+    auto* mapper = getInterpolator(1);
+
+    PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> crse_bndry_func(
+      geom[lev - 1], bcrec_stats, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+    PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> fine_bndry_func(
+      geom[lev], bcrec_stats, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+    FillPatchTwoLevels(
+      a_stats, IntVect(nGhost), a_time, {m_stats[lev - 1].get()}, {a_time},
+      {m_stats[lev].get()}, {a_time}, 0, 0, ncomp, geom[lev - 1], geom[lev],
+      crse_bndry_func, 0, fine_bndry_func, 0, refRatio(lev - 1), mapper,
+      bcrec_stats, 0);
+  }
+}
+
 // Fill the state
 void
 PeleLM::fillcoarsepatch_state(
@@ -825,6 +856,28 @@ PeleLM::fillcoarsepatch_reaction(
     refRatio(lev - 1), mapper, {m_bcrec_force}, 0);
 }
 
+// Fill coarse patch of the statistics accumulators
+void
+PeleLM::fillcoarsepatch_stats(
+  int lev, const amrex::Real a_time, amrex::MultiFab& a_stats, int nGhost)
+{
+  ProbParm const* lprobparm = prob_parm_d;
+  const int ncomp = a_stats.nComp();
+  Vector<BCRec> bcrec_stats(ncomp, m_bcrec_force[0]);
+
+  // Interpolator
+  auto* mapper = getInterpolator(1);
+
+  PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> crse_bndry_func(
+    geom[lev - 1], bcrec_stats, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+  PhysBCFunct<GpuBndryFuncFab<PeleLMCCFillExtDirDummy>> fine_bndry_func(
+    geom[lev], bcrec_stats, PeleLMCCFillExtDirDummy{lprobparm, m_nAux});
+  InterpFromCoarseLevel(
+    a_stats, IntVect(nGhost), a_time, *m_stats[lev - 1], 0, 0, ncomp,
+    geom[lev - 1], geom[lev], crse_bndry_func, 0, fine_bndry_func, 0,
+    refRatio(lev - 1), mapper, bcrec_stats, 0);
+}
+
 // Fill coarse patch of chem function call
 void
 PeleLM::fillcoarsepatch_chemFunctCall(
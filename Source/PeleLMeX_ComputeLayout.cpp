@@ -0,0 +1,131 @@
+#include "PeleLMeX_ComputeLayout.H"
+
+#include <AMReX_BoxIterator.H>
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Print.H>
+
+using namespace amrex;
+
+namespace {
+const char*
+kernelName(ComputeLayout::Kernel a_kernel)
+{
+  switch (a_kernel) {
+  case ComputeLayout::Transport:
+    return "transport";
+  case ComputeLayout::Temperature:
+    return "temperature";
+  case ComputeLayout::ThermoPress:
+    return "thermo. pressure";
+  default:
+    return "unknown";
+  }
+}
+} // namespace
+
+void
+ComputeLayout::define(int a_maxLevel, const IntVect& a_boxSize, int a_verbose)
+{
+  AMREX_ALWAYS_ASSERT(a_boxSize.min() > 0);
+  m_active = true;
+  m_verbose = a_verbose;
+  m_boxSize = a_boxSize;
+  m_levels.resize(a_maxLevel + 1);
+}
+
+bool
+ComputeLayout::use(
+  int a_lev,
+  Kernel a_kernel,
+  const BoxArray& a_ba,
+  const DistributionMapping& a_dm)
+{
+  if (!m_active) {
+    return false;
+  }
+
+  auto& level = m_levels[a_lev];
+  if (level.srcBA != a_ba || level.srcDM != a_dm) {
+    level.srcBA = a_ba;
+    level.srcDM = a_dm;
+    level.ba = makeBoxArray(a_ba, m_boxSize);
+    // Nothing to gain when the grids are already compact
+    const Status start = (level.ba == a_ba) ? UseGrids : ProbeGrids;
+    level.status.fill(start);
+    if (start == ProbeGrids) {
+      level.dm = DistributionMapping(level.ba);
+    }
+    if (m_verbose > 1) {
+      Print() << " Compute layout on level " << a_lev << ": "
+              << level.ba.size() << " boxes for " << a_ba.size()
+              << " AMR grids\n";
+    }
+  }
+
+  const Status status = level.status[a_kernel];
+  return status == ProbeLayout || status == UseLayout;
+}
+
+void
+ComputeLayout::record(int a_lev, Kernel a_kernel, Real a_time)
+{
+  if (!m_active) {
+    return;
+  }
+
+  auto& level = m_levels[a_lev];
+  Status& status = level.status[a_kernel];
+  if (status == ProbeGrids) {
+    level.gridsTime[a_kernel] = a_time;
+    status = ProbeLayout;
+  } else if (status == ProbeLayout) {
+    level.layoutTime[a_kernel] = a_time;
+    // The slowest rank sets the pace
+    Real times[2] = {level.gridsTime[a_kernel], level.layoutTime[a_kernel]};
+    ParallelDescriptor::ReduceRealMax(times, 2);
+    status = (times[1] < times[0]) ? UseLayout : UseGrids;
+    if (m_verbose > 0) {
+      Print() << " Compute layout for " << kernelName(a_kernel)
+              << " on level " << a_lev << ": grids " << times[0]
+              << " s, layout " << times[1] << " s, using the "
+              << ((status == UseLayout) ? "layout" : "grids") << "\n";
+    }
+  }
+}
+
+BoxArray
+ComputeLayout::makeBoxArray(const BoxArray& a_ba, const IntVect& a_boxSize)
+{
+  // Lattice boxes overlapping the grids
+  BoxArray lattice(a_ba);
+  lattice.coarsen(a_boxSize);
+  lattice.removeOverlap();
+
+  BoxList bl(a_ba.ixType());
+  std::vector<std::pair<int, Box>> isects;
+  for (int n = 0; n < lattice.size(); ++n) {
+    const Box& crse = lattice[n];
+    for (BoxIterator bit(crse); bit.ok(); ++bit) {
+      const IntVect& iv = bit();
+      a_ba.intersections(amrex::refine(Box(iv, iv), a_boxSize), isects);
+      if (isects.empty()) {
+        continue;
+      }
+      // Merge the pieces when they tile a box
+      Box hull = isects[0].second;
+      Long npts = 0;
+      for (const auto& is : isects) {
+        hull.minBox(is.second);
+        npts += is.second.numPts();
+      }
+      if (npts == hull.numPts()) {
+        bl.push_back(hull);
+      } else {
+        for (const auto& is : isects) {
+          bl.push_back(is.second);
+        }
+      }
+    }
+  }
+  return BoxArray(std::move(bl));
+}
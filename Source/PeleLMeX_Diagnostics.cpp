@@ -1,4 +1,6 @@
 #include <PeleLMeX.H>
+#include <limits>
+#include <set>
 
 using namespace amrex;
 
@@ -93,3 +95,222 @@ PeleLM::doDiagnostics()
     }
   }
 }
+
+void
+PeleLM::createSamplers()
+{
+  ParmParse pp("peleLM");
+  int n_samplers = pp.countval("samplers");
+  if (n_samplers == 0) {
+    return;
+  }
+
+  // Spread the writers over the ranks
+  m_samplers.resize(n_samplers);
+  for (int n = 0; n < n_samplers; ++n) {
+    std::string name;
+    pp.get("samplers", name, n);
+    m_samplers[n] =
+      std::make_unique<Sampler>(name, n % ParallelDescriptor::NProcs());
+    for (const auto& v : m_samplers[n]->fieldNames()) {
+      bool itexists =
+        derive_lst.canDerive(v) || isStateVariable(v) || isReactVariable(v);
+      if (!itexists) {
+        Abort("Field " + v + " is not available");
+      }
+    }
+  }
+  UtilCreateDirectory("samples", 0755);
+}
+
+void
+PeleLM::doSampling()
+{
+  BL_PROFILE("PeleLMeX::doSampling()");
+
+  for (const auto& sampler : m_samplers) {
+    if (!sampler->doSample(m_nstep)) {
+      continue;
+    }
+
+    const auto& points = sampler->points();
+    const auto& fields = sampler->fieldNames();
+    const int npts = static_cast<int>(points.size());
+    const int nvars = static_cast<int>(fields.size());
+
+    // Locate each point on the finest level covering it. Fine data are
+    // used when available, coarse cell values otherwise (piecewise constant,
+    // i.e. conservative). All the ranks get the same answer.
+    Vector<std::set<int>> probeBoxes(finest_level + 1);
+    Vector<Vector<int>> localPts(finest_level + 1);
+    Vector<Vector<int>> localFabs(finest_level + 1);
+    Vector<Vector<IntVect>> localIvs(finest_level + 1);
+    for (int p = 0; p < npts; ++p) {
+      if (!geom[0].insideRoundoffDomain(
+            AMREX_D_DECL(points[p][0], points[p][1], points[p][2]))) {
+        continue;
+      }
+      for (int lev = finest_level; lev >= 0; --lev) {
+        const auto problo = geom[lev].ProbLoArray();
+        const auto dxinv = geom[lev].InvCellSizeArray();
+        IntVect iv(AMREX_D_DECL(
+          static_cast<int>(std::floor((points[p][0] - problo[0]) * dxinv[0])),
+          static_cast<int>(std::floor((points[p][1] - problo[1]) * dxinv[1])),
+          static_cast<int>(std::floor((points[p][2] - problo[2]) * dxinv[2]))));
+        iv.min(geom[lev].Domain().bigEnd());
+        iv.max(geom[lev].Domain().smallEnd());
+        auto isects = grids[lev].intersections(Box(iv, iv), true, 0);
+        if (!isects.empty()) {
+          const int fabIdx = isects[0].first;
+          probeBoxes[lev].insert(fabIdx);
+          if (dmap[lev][fabIdx] == ParallelDescriptor::MyProc()) {
+            localPts[lev].push_back(p);
+            localFabs[lev].push_back(fabIdx);
+            localIvs[lev].push_back(iv);
+          }
+          break;
+        }
+      }
+    }
+
+    // Fetch the local values. State and reaction variables are read in
+    // place, the derived variables are evaluated on the boxes holding
+    // points only. The values of a level are read with a single kernel.
+    Vector<int> sendIdx;
+    Vector<Real> sendVals;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      if (probeBoxes[lev].empty()) {
+        continue;
+      }
+      Vector<const MultiFab*> srcMF(nvars, nullptr);
+      Vector<int> srcComp(nvars, 0);
+      Vector<int> srcDerived(nvars, 0);
+      Vector<std::string> derNames;
+      Vector<int> derVars;
+      for (int v = 0; v < nvars; ++v) {
+        const bool derived = (derive_lst.get(fields[v]) != nullptr);
+        if (!derived && isStateVariable(fields[v])) {
+          srcMF[v] = &m_leveldata_new[lev]->state;
+          srcComp[v] = stateVariableIndex(fields[v]);
+        } else if (
+          !derived && (m_do_react != 0) && isReactVariable(fields[v])) {
+          srcMF[v] = &m_leveldatareact[lev]->I_R;
+          srcComp[v] = reactVariableIndex(fields[v]);
+        } else {
+          derNames.push_back(fields[v]);
+          derVars.push_back(v);
+        }
+      }
+      const Vector<int> derBoxes(
+        probeBoxes[lev].begin(), probeBoxes[lev].end());
+      std::unique_ptr<MultiFab> derMF;
+      if (!derNames.empty()) {
+        derMF = deriveMulti(derNames, m_cur_time, lev, 0, &derBoxes);
+        for (int n = 0; n < derVars.size(); ++n) {
+          srcMF[derVars[n]] = derMF.get();
+          srcComp[derVars[n]] = n;
+          srcDerived[derVars[n]] = 1;
+        }
+      }
+
+      const int nloc = static_cast<int>(localPts[lev].size());
+      if (nloc == 0) {
+        continue;
+      }
+
+      // Local index of the box holding each point, in the level layout and
+      // in the derived data layout
+      Vector<int> boxNo(static_cast<Long>(nloc) * 2);
+      for (int i = 0; i < nloc; ++i) {
+        const int fabIdx = localFabs[lev][i];
+        boxNo[2 * i] = m_leveldata_new[lev]->state.localindex(fabIdx);
+        if (derMF) {
+          const auto it =
+            std::lower_bound(derBoxes.begin(), derBoxes.end(), fabIdx);
+          boxNo[2 * i + 1] =
+            derMF->localindex(static_cast<int>(it - derBoxes.begin()));
+        }
+      }
+      Vector<MultiArray4<Real const>> arrs(nvars);
+      for (int v = 0; v < nvars; ++v) {
+        arrs[v] = srcMF[v]->const_arrays();
+      }
+
+      Gpu::DeviceVector<IntVect> d_ivs(nloc);
+      Gpu::DeviceVector<int> d_boxNo(boxNo.size());
+      Gpu::DeviceVector<MultiArray4<Real const>> d_arrs(nvars);
+      Gpu::DeviceVector<int> d_comp(nvars);
+      Gpu::DeviceVector<int> d_derived(nvars);
+      Gpu::DeviceVector<Real> d_vals(static_cast<Long>(nloc) * nvars);
+      Gpu::copyAsync(
+        Gpu::hostToDevice, localIvs[lev].begin(), localIvs[lev].end(),
+        d_ivs.begin());
+      Gpu::copyAsync(
+        Gpu::hostToDevice, boxNo.begin(), boxNo.end(), d_boxNo.begin());
+      Gpu::copyAsync(
+        Gpu::hostToDevice, arrs.begin(), arrs.end(), d_arrs.begin());
+      Gpu::copyAsync(
+        Gpu::hostToDevice, srcComp.begin(), srcComp.end(), d_comp.begin());
+      Gpu::copyAsync(
+        Gpu::hostToDevice, srcDerived.begin(), srcDerived.end(),
+        d_derived.begin());
+      const IntVect* ivp = d_ivs.data();
+      const int* boxp = d_boxNo.data();
+      const MultiArray4<Real const>* arrp = d_arrs.data();
+      const int* compp = d_comp.data();
+      const int* derp = d_derived.data();
+      Real* valp = d_vals.data();
+      amrex::ParallelFor(nloc * nvars, [=] AMREX_GPU_DEVICE(int n) noexcept {
+        const int i = n / nvars;
+        const int v = n - i * nvars;
+        valp[n] = arrp[v][boxp[2 * i + derp[v]]](ivp[i], compp[v]);
+      });
+      const Long nsend = sendVals.size();
+      sendVals.resize(nsend + static_cast<Long>(nloc) * nvars);
+      Gpu::copy(
+        Gpu::deviceToHost, d_vals.begin(), d_vals.end(),
+        sendVals.begin() + nsend);
+      sendIdx.insert(
+        sendIdx.end(), localPts[lev].begin(), localPts[lev].end());
+    }
+
+    // Gather the values of the points owned by each rank on the writer rank
+    // and write to disk
+    const int writer = sampler->writerRank();
+    const int nprocs = ParallelDescriptor::NProcs();
+    const int nsendPts = static_cast<int>(sendIdx.size());
+    std::vector<int> recvPts(nprocs, 0);
+    ParallelDescriptor::Gather(&nsendPts, 1, recvPts.data(), writer);
+    std::vector<int> ptsDisp(nprocs, 0);
+    std::vector<int> recvVals(nprocs, 0);
+    std::vector<int> valsDisp(nprocs, 0);
+    for (int r = 0; r < nprocs; ++r) {
+      recvVals[r] = recvPts[r] * nvars;
+      if (r > 0) {
+        ptsDisp[r] = ptsDisp[r - 1] + recvPts[r - 1];
+        valsDisp[r] = valsDisp[r - 1] + recvVals[r - 1];
+      }
+    }
+    const bool isWriter = (ParallelDescriptor::MyProc() == writer);
+    Vector<int> allIdx(isWriter ? ptsDisp.back() + recvPts.back() : 0);
+    Vector<Real> allVals(isWriter ? valsDisp.back() + recvVals.back() : 0);
+    ParallelDescriptor::Gatherv(
+      sendIdx.data(), nsendPts, allIdx.data(), recvPts, ptsDisp, writer);
+    ParallelDescriptor::Gatherv(
+      sendVals.data(), nsendPts * nvars, allVals.data(), recvVals, valsDisp,
+      writer);
+    if (isWriter) {
+      // Points outside of the domain are left as NaN
+      Vector<Real> values(
+        static_cast<Long>(npts) * nvars,
+        std::numeric_limits<Real>::quiet_NaN());
+      for (int n = 0; n < allIdx.size(); ++n) {
+        for (int v = 0; v < nvars; ++v) {
+          values[static_cast<Long>(allIdx[n]) * nvars + v] =
+            allVals[static_cast<Long>(n) * nvars + v];
+        }
+      }
+      sampler->write(m_nstep, m_cur_time, values);
+    }
+  }
+}
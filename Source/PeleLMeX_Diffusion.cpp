@@ -111,8 +111,7 @@ PeleLM::computeDifferentialDiffusionTerms(
   // If doing species balances, compute face domain integrals
   // using level 0 since we've averaged down the fluxes already
   // Factor for SDC is 0.5 is for Dn and -0.5 for Dnp1
-  if (
-    (m_sdcIter == 0 || m_sdcIter == m_nSDCmax) && (m_do_speciesBalance != 0)) {
+  if ((m_sdcIter == 0 || isBalanceSDCIter()) && (m_do_speciesBalance != 0)) {
     Real sdc_weight = (a_time == AmrOldTime) ? 0.5 : -0.5;
     addRhoYFluxes(GetArrOfConstPtrs(fluxes[0]), geom[0], sdc_weight);
   }
@@ -1059,7 +1058,7 @@ PeleLM::differentialDiffusionUpdate(
 
   // If doing species balances, compute face domain integrals
   // using level 0 since we've averaged down the fluxes already
-  if (m_sdcIter == m_nSDCmax && (m_do_speciesBalance != 0)) {
+  if (isBalanceSDCIter() && (m_do_speciesBalance != 0)) {
     addRhoYFluxes(GetArrOfConstPtrs(fluxes[0]), geom[0]);
   }
   //------------------------------------------------------------------------
@@ -250,6 +250,8 @@ DiffusionOp::diffuse_scalar(
     // Solve
     mlmg.solve(
       GetVecOfPtrs(component), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+    m_pelelm->m_perfTrace.addSolverIters(
+      PerfTrace::ScalarSolve, mlmg.getNumIters());
 
     // Need to get the fluxes
     if (have_fluxes != 0) {
@@ -457,6 +459,8 @@ DiffusionOp::diffuse_scalar(
     // Solve
     mlmg.solve(
       GetVecOfPtrs(component), GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+    m_pelelm->m_perfTrace.addSolverIters(
+      PerfTrace::ScalarSolve, mlmg.getNumIters());
 
     // Need to get the fluxes
     if (have_fluxes != 0) {
@@ -1221,6 +1225,8 @@ DiffusionTensorOp::diffuse_velocity(
   mlmg.setPostSmooth(m_num_post_smooth);
 
   mlmg.solve(a_vel, GetVecOfConstPtrs(rhs), m_mg_rtol, m_mg_atol);
+  m_pelelm->m_perfTrace.addSolverIters(
+    PerfTrace::TensorSolve, mlmg.getNumIters());
 }
 
 void
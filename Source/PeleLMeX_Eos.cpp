@@ -23,18 +23,36 @@ PeleLM::setThermoPress(int lev, const TimeStamp& a_time)
   AMREX_ASSERT(a_time == AmrOldTime || a_time == AmrNewTime);
 
   auto* ldata_p = getLevelDataPtr(lev, a_time);
-  auto const& sma = ldata_p->state.arrays();
+  MultiFab& state = ldata_p->state;
+
+  // Optionally work on a copy of rho, rhoY, rhoH, T on the compute layout
+  const Real strt_time = ParallelDescriptor::second();
+  const bool useLayout = m_computeLayout.use(
+    lev, ComputeLayout::ThermoPress, state.boxArray(), state.DistributionMap());
+  MultiFab layoutState;
+  if (useLayout) {
+    layoutState.define(
+      m_computeLayout.boxArray(lev), m_computeLayout.DistributionMap(lev),
+      state.nComp(), 0);
+    layoutState.ParallelCopy(state, DENSITY, DENSITY, NUM_SPECIES + 3);
+  }
+  MultiFab& workState = useLayout ? layoutState : state;
+  auto const& sma = workState.arrays();
 
   amrex::ParallelFor(
-    ldata_p->state,
-    [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+    workState, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
       getPGivenRTY(
         i, j, k, Array4<Real const>(sma[box_no], DENSITY),
         Array4<Real const>(sma[box_no], FIRSTSPEC),
         Array4<Real const>(sma[box_no], TEMP),
         Array4<Real>(sma[box_no], RHORT));
     });
+  if (useLayout) {
+    state.ParallelCopy(layoutState, RHORT, RHORT, 1);
+  }
   Gpu::streamSynchronize();
+  m_computeLayout.record(
+    lev, ComputeLayout::ThermoPress, ParallelDescriptor::second() - strt_time);
 }
 
 void
@@ -218,17 +236,35 @@ PeleLM::setTemperature(int lev, const TimeStamp& a_time)
   AMREX_ASSERT(a_time == AmrOldTime || a_time == AmrNewTime);
 
   auto* ldata_p = getLevelDataPtr(lev, a_time);
-  auto const& sma = ldata_p->state.arrays();
+  MultiFab& state = ldata_p->state;
+
+  // Optionally work on a copy of rho, rhoY, rhoH, T on the compute layout
+  const Real strt_time = ParallelDescriptor::second();
+  const bool useLayout = m_computeLayout.use(
+    lev, ComputeLayout::Temperature, state.boxArray(), state.DistributionMap());
+  MultiFab layoutState;
+  if (useLayout) {
+    layoutState.define(
+      m_computeLayout.boxArray(lev), m_computeLayout.DistributionMap(lev),
+      state.nComp(), 0);
+    layoutState.ParallelCopy(state, DENSITY, DENSITY, NUM_SPECIES + 3);
+  }
+  MultiFab& workState = useLayout ? layoutState : state;
+  auto const& sma = workState.arrays();
 
   amrex::ParallelFor(
-    ldata_p->state,
-    [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+    workState, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
       getTfromHY(
         i, j, k, Array4<Real const>(sma[box_no], DENSITY),
         Array4<Real const>(sma[box_no], FIRSTSPEC),
         Array4<Real const>(sma[box_no], RHOH), Array4<Real>(sma[box_no], TEMP));
     });
+  if (useLayout) {
+    state.ParallelCopy(layoutState, TEMP, TEMP, 1);
+  }
   Gpu::streamSynchronize();
+  m_computeLayout.record(
+    lev, ComputeLayout::Temperature, ParallelDescriptor::second() - strt_time);
 }
 
 void
@@ -302,11 +338,12 @@ PeleLM::adjustPandDivU(std::unique_ptr<AdvanceAdvData>& advData)
   }
   Gpu::streamSynchronize();
 
-  // Get the mean mac_divu (Sbar) and mean theta
-  Real Sbar = MFSum(GetVecOfConstPtrs(advData->mac_divu), 0);
-  Sbar /= m_uncoveredVol;
-  Real Thetabar = MFSum(GetVecOfConstPtrs(ThetaHalft), 0);
-  Thetabar /= m_uncoveredVol;
+  // Get the mean mac_divu (Sbar) and mean theta in a single reduction
+  auto integrals = MFSum(
+    {GetVecOfConstPtrs(advData->mac_divu), GetVecOfConstPtrs(ThetaHalft)},
+    {0, 0});
+  Real Sbar = integrals[0] / m_uncoveredVol;
+  Real Thetabar = integrals[1] / m_uncoveredVol;
 
   // Adjust
   for (int lev = 0; lev <= finest_level; ++lev) {
@@ -1,4 +1,5 @@
 #include <PeleLMeX.H>
+#include <algorithm>
 
 using namespace amrex;
 
@@ -13,6 +14,8 @@ PeleLM::Evolve()
   int plt_justDidIt = 0;
   int chk_justDidIt = 0;
 
+  m_lastRegridStep = m_nstep;
+
   while (!do_not_evolve) {
 
     plt_justDidIt = 0;
@@ -26,15 +29,44 @@ PeleLM::Evolve()
 #ifdef PELE_USE_SPRAY
     bool regridded = false;
 #endif
-    if ((m_regrid_int > 0) && (m_nstep > 0) && (m_nstep % m_regrid_int == 0)) {
+    // Coarsest level to regrid from, the levels up to it are unchanged
+    int regridLev = -1;
+    if ((m_regrid_int > 0) && (m_nstep > 0)) {
+      if (m_regridOnDemand != 0) {
+        // Check the tags drift every regrid_check_int steps once regrid_int
+        // steps have elapsed, and regrid anyway after regrid_max_int steps
+        const int sinceRegrid = m_nstep - m_lastRegridStep;
+        if (sinceRegrid >= m_regridMaxInt) {
+          if (m_verbose > 0) {
+            amrex::Print() << " Regrid triggered by regrid_max_int\n";
+          }
+          regridLev = 0;
+        } else if (
+          sinceRegrid >= m_regrid_int &&
+          (sinceRegrid - m_regrid_int) % m_regridCheckInt == 0) {
+          regridLev = regridNeeded();
+        }
+      } else if (m_regridLevelInt.empty()) {
+        regridLev = (m_nstep % m_regrid_int == 0) ? 0 : -1;
+      } else {
+        const int nLevInt = std::min(finest_level + 1, max_level);
+        for (int lev = 0; lev < nLevInt && regridLev < 0; ++lev) {
+          if (m_nstep % m_regridLevelInt[lev] == 0) {
+            regridLev = lev;
+          }
+        }
+      }
+    }
+    if (regridLev >= 0) {
       if (m_verbose > 0) {
-        amrex::Print() << " Regridding...\n";
+        amrex::Print() << " Regridding from level " << regridLev << "...\n";
       }
       // Average down I_R to have proper values in newly uncovered areas
       if (m_incompressible == 0) {
         averageDownReaction();
       }
-      regrid(0, m_cur_time);
+      regrid(regridLev, m_cur_time);
+      m_lastRegridStep = m_nstep;
       resetMacProjector();
       resetCoveredMask();
 #ifdef PELE_USE_SPRAY
@@ -59,6 +91,9 @@ PeleLM::Evolve()
     }
 #endif
 
+    // Statistics accumulation
+    updateStatistics();
+
     // Active control
     int is_restart = 0;
     activeControl(is_restart);
@@ -68,8 +103,14 @@ PeleLM::Evolve()
       writeTemporals();
     }
 
+    // Performance trace
+    if (m_perfTrace.writeNow(m_nstep)) {
+      writePerfTrace();
+    }
+
     // Diagnostics
     doDiagnostics();
+    doSampling();
 
     // Check message
     bool dump_and_stop = checkMessage("dump_and_stop");
@@ -54,12 +54,7 @@ PeleLM::MakeNewLevelFromScratch(
   SetDistributionMap(lev, dm);
 
   // Define the FAB Factory
-#ifdef AMREX_USE_EB
-  m_factory[lev] = makeEBFabFactory(
-    geom[lev], grids[lev], dmap[lev], {6, 6, 6}, EBSupport::full);
-#else
-  m_factory[lev] = std::make_unique<FArrayBoxFactory>();
-#endif
+  m_factory[lev] = makeLevelFactory(lev, grids[lev], dmap[lev]);
 
   // Initialize the LevelData
   m_leveldata_old[lev] = std::make_unique<LevelData>(
@@ -83,6 +78,12 @@ PeleLM::MakeNewLevelFromScratch(
     m_leveldatareact[lev]->I_R.setVal(0.0);
   }
 
+  if (m_do_stats != 0) {
+    m_stats[lev] = std::make_unique<MultiFab>(
+      grids[lev], dmap[lev], 1 + 4 * static_cast<int>(m_statsVars.size()), 0);
+    m_stats[lev]->setVal(0.0);
+  }
+
 #ifdef PELE_USE_EFIELD
   m_leveldatanlsolve[lev].reset(
     new LevelDataNLSolve(grids[lev], dmap[lev], *m_factory[lev], m_nGrowState));
@@ -177,6 +178,9 @@ PeleLM::initData()
 
   if (m_restart_chkfile.empty()) {
     //----------------------------------------------------------------
+    Real phaseStart = ParallelDescriptor::second();
+    m_initPltReuse =
+      ((m_initPltFast != 0) && !m_restart_pltfile.empty()) ? 1 : 0;
     if (!m_initial_grid_file.empty()) {
       InitFromGridFile(m_cur_time);
     } else {
@@ -184,6 +188,14 @@ PeleLM::initData()
       // with MakeNewLevelFromScratch.
       InitFromScratch(m_cur_time);
     }
+    m_initPltData.reset();
+    if ((m_initPltFast != 0) && !m_restart_pltfile.empty()) {
+      Print() << " Fast init from pltfile: "
+              << ((m_initPltReuse != 0)
+                    ? "reusing the pltfile gradp/divU/I_R\n"
+                    : "pltfile data not reusable on all levels, full init\n");
+    }
+    Real dataInitTime = ParallelDescriptor::second() - phaseStart;
     resetCoveredMask();
     updateDiagnostics();
 
@@ -224,7 +236,9 @@ PeleLM::initData()
 
     //----------------------------------------------------------------
     // Project initial solution
+    phaseStart = ParallelDescriptor::second();
     projectInitSolution();
+    Real projTime = ParallelDescriptor::second() - phaseStart;
 
     // Active control
     int is_restart = 0;
@@ -232,7 +246,18 @@ PeleLM::initData()
 
     //----------------------------------------------------------------
     // Do initial pressure iterations
+    phaseStart = ParallelDescriptor::second();
     initialIterations();
+    Real initIterTime = ParallelDescriptor::second() - phaseStart;
+
+    if (m_verbose > 0) {
+      ParallelDescriptor::ReduceRealMax(dataInitTime);
+      ParallelDescriptor::ReduceRealMax(projTime);
+      ParallelDescriptor::ReduceRealMax(initIterTime);
+      Print() << " Initialization timing: data " << dataInitTime
+              << " s, initial projection(s) " << projTime
+              << " s, initial iterations " << initIterTime << " s\n";
+    }
 
     if (m_do_reset_time != 0) {
       m_nstep = 0;
@@ -383,7 +408,45 @@ PeleLM::projectInitSolution()
   Real dtInit = computeDt(is_init, AmrNewTime);
   Print() << " Initial dt: " << dtInit << "\n";
 
-  if (m_do_init_proj != 0) {
+  // The reused divU must be consistent with the initial state, which can
+  // differ from the pltfile one (rho and rhoH are recomputed from the EOS)
+  if ((m_initPltReuse != 0) && (m_has_divu != 0)) {
+    Vector<MultiFab> pltDivu(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      pltDivu[lev].define(grids[lev], dmap[lev], 1, 0);
+      MultiFab::Copy(
+        pltDivu[lev], getLevelDataPtr(lev, AmrNewTime)->divu, 0, 0, 1, 0);
+    }
+    std::unique_ptr<AdvanceDiffData> diffData;
+    diffData = std::make_unique<AdvanceDiffData>(
+      finest_level, grids, dmap, m_factory, m_nGrowAdv, m_use_wbar,
+      m_use_soret, is_init);
+    calcDivU(is_init, 1, 1, AmrNewTime, diffData);
+    Real divuMax = 0.0;
+    Real residualMax = 0.0;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      auto& divu = getLevelDataPtr(lev, AmrNewTime)->divu;
+      divuMax = std::max(divuMax, pltDivu[lev].norm0(0, 0, true));
+      MultiFab::Subtract(pltDivu[lev], divu, 0, 0, 1, 0);
+      residualMax = std::max(residualMax, pltDivu[lev].norm0(0, 0, true));
+      // Keep the pltfile divU, consistent with the pltfile velocity
+      MultiFab::Add(divu, pltDivu[lev], 0, 0, 1, 0);
+    }
+    ParallelDescriptor::ReduceRealMax(divuMax);
+    ParallelDescriptor::ReduceRealMax(residualMax);
+    if (residualMax > m_initPltFastDivuTol * divuMax) {
+      Print() << " Fast init from pltfile: divU residual " << residualMax
+              << " larger than " << m_initPltFastDivuTol << " x " << divuMax
+              << ", full init\n";
+      m_initPltReuse = 0;
+    }
+  }
+
+  if (m_initPltReuse != 0) {
+    // Velocity, gradp, divU (and I_R) are already consistent in the pltfile
+    Print() << "\n Skipping initial projection(s), reusing pltfile data \n";
+    Print() << PrettyLine;
+  } else if (m_do_init_proj != 0) {
 
     Print() << "\n Doing initial projection(s) \n\n";
     // Subcycling IAMR/PeleLM first does a projection with no reaction divU
@@ -486,7 +549,10 @@ PeleLM::initialIterations()
 {
   BL_PROFILE("PeleLMeX::initialIterations()");
 
-  if (m_verbose > 0 && m_init_iter > 0) {
+  // Shortened initial iterations when reusing consistent pltfile data
+  const int nInitIter = (m_initPltReuse != 0) ? m_initPltFastIter : m_init_iter;
+
+  if (m_verbose > 0 && nInitIter > 0) {
     amrex::Print() << "\n Doing initial pressure iteration(s) \n";
   }
 
@@ -496,7 +562,7 @@ PeleLM::initialIterations()
 
   //----------------------------------------------------------------
   // Initial pressure iterations
-  for (int iter = 0; iter < m_init_iter; iter++) {
+  for (int iter = 0; iter < nInitIter; iter++) {
 
     if (m_verbose > 0) {
       amrex::Print() << "\n ================   INITIAL ITERATION [" << iter
@@ -0,0 +1,194 @@
+#include "PeleLMeX_NodeLoadBalance.H"
+
+#include <AMReX_ParallelDescriptor.H>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+using namespace amrex;
+
+namespace {
+// Interleave the bits of the (non-negative) cell indices
+std::uint64_t
+mortonKey(const IntVect& a_iv)
+{
+  constexpr int nbits = 64 / AMREX_SPACEDIM;
+  std::uint64_t key = 0;
+  for (int b = 0; b < nbits; ++b) {
+    for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+      const auto bit = (static_cast<std::uint64_t>(a_iv[idim]) >> b) & 1ULL;
+      key |= bit << (b * AMREX_SPACEDIM + idim);
+    }
+  }
+  return key;
+}
+} // namespace
+
+namespace NodeLoadBalance {
+
+const Vector<int>&
+rankNodes(int a_nodeSize)
+{
+  static Vector<int> nodes;
+  static int nodeSize = -1;
+  if (nodeSize == a_nodeSize && !nodes.empty()) {
+    return nodes;
+  }
+  nodeSize = a_nodeSize;
+
+  const int nprocs = ParallelDescriptor::NProcs();
+  nodes.resize(nprocs, 0);
+  if (a_nodeSize > 0) {
+    for (int r = 0; r < nprocs; ++r) {
+      nodes[r] = r / a_nodeSize;
+    }
+    return nodes;
+  }
+
+#ifdef AMREX_USE_MPI
+  // World rank of the leader of the node of this rank
+  MPI_Comm comm = ParallelDescriptor::Communicator();
+  MPI_Comm nodeComm = MPI_COMM_NULL;
+  const int myProc = ParallelDescriptor::MyProc();
+  MPI_Comm_split_type(
+    comm, MPI_COMM_TYPE_SHARED, myProc, MPI_INFO_NULL, &nodeComm);
+  int leader = myProc;
+  MPI_Bcast(&leader, 1, MPI_INT, 0, nodeComm);
+  MPI_Comm_free(&nodeComm);
+  Vector<int> leaders(nprocs, 0);
+  MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, comm);
+
+  // Number the nodes in the order of their leader rank
+  Vector<int> sortedLeaders(leaders);
+  std::sort(sortedLeaders.begin(), sortedLeaders.end());
+  sortedLeaders.erase(
+    std::unique(sortedLeaders.begin(), sortedLeaders.end()),
+    sortedLeaders.end());
+  for (int r = 0; r < nprocs; ++r) {
+    nodes[r] = static_cast<int>(
+      std::lower_bound(sortedLeaders.begin(), sortedLeaders.end(), leaders[r]) -
+      sortedLeaders.begin());
+  }
+#endif
+  return nodes;
+}
+
+DistributionMapping
+makeDistributionMap(
+  const Vector<Real>& a_cost,
+  const BoxArray& a_ba,
+  const Vector<int>& a_rankNodes)
+{
+  const int nboxes = static_cast<int>(a_ba.size());
+  const int nprocs = static_cast<int>(a_rankNodes.size());
+  AMREX_ALWAYS_ASSERT(a_cost.size() == nboxes);
+
+  // Ranks of each node
+  const int nNodes =
+    *std::max_element(a_rankNodes.begin(), a_rankNodes.end()) + 1;
+  Vector<Vector<int>> nodeRanks(nNodes);
+  for (int r = 0; r < nprocs; ++r) {
+    nodeRanks[a_rankNodes[r]].push_back(r);
+  }
+
+  // Order the boxes along the Morton curve of their centers
+  const IntVect lo = a_ba.minimalBox().smallEnd();
+  Vector<std::uint64_t> keys(nboxes);
+  for (int i = 0; i < nboxes; ++i) {
+    const Box& bx = a_ba[i];
+    keys[i] = mortonKey((bx.smallEnd() + bx.bigEnd()) / 2 - lo);
+  }
+  Vector<int> order(nboxes);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&keys](int a, int b) {
+    return keys[a] < keys[b];
+  });
+
+  // Inter-node stage: contiguous chunks of the curve, the cost remaining
+  // after the previous nodes being shared in proportion to the number of
+  // ranks of each remaining node
+  const Real totalCost = std::accumulate(a_cost.begin(), a_cost.end(), 0.0);
+  Vector<Vector<int>> nodeBoxes(nNodes);
+  int node = 0;
+  int ranksBeforeNode = 0;
+  Real cumCost = 0.0;
+  Real nodeEnd = totalCost * static_cast<Real>(nodeRanks[0].size()) /
+                 static_cast<Real>(nprocs);
+  for (const int i : order) {
+    // Move to the next node once the box midpoint is past the end of the
+    // current one, without leaving a node empty
+    while (node < nNodes - 1 && !nodeBoxes[node].empty() &&
+           cumCost + 0.5 * a_cost[i] > nodeEnd) {
+      ranksBeforeNode += static_cast<int>(nodeRanks[node].size());
+      ++node;
+      nodeEnd = cumCost + (totalCost - cumCost) *
+                            static_cast<Real>(nodeRanks[node].size()) /
+                            static_cast<Real>(nprocs - ranksBeforeNode);
+    }
+    nodeBoxes[node].push_back(i);
+    cumCost += a_cost[i];
+  }
+
+  // Intra-node stage: largest boxes first on the least loaded rank
+  Vector<int> pmap(nboxes, 0);
+  for (int n = 0; n < nNodes; ++n) {
+    auto& boxes = nodeBoxes[n];
+    std::stable_sort(boxes.begin(), boxes.end(), [&a_cost](int a, int b) {
+      return a_cost[a] > a_cost[b];
+    });
+    const auto& ranks = nodeRanks[n];
+    Vector<Real> rankCost(ranks.size(), 0.0);
+    for (const int i : boxes) {
+      const auto r = std::min_element(rankCost.begin(), rankCost.end()) -
+                     rankCost.begin();
+      pmap[i] = ranks[r];
+      rankCost[r] += a_cost[i];
+    }
+  }
+
+  return DistributionMapping(std::move(pmap));
+}
+
+Real
+efficiency(const Vector<Real>& a_cost, const DistributionMapping& a_dm)
+{
+  Vector<Real> rankCost(ParallelDescriptor::NProcs(), 0.0);
+  const auto& pmap = a_dm.ProcessorMap();
+  for (int i = 0; i < a_cost.size(); ++i) {
+    rankCost[pmap[i]] += a_cost[i];
+  }
+  const Real maxCost = *std::max_element(rankCost.begin(), rankCost.end());
+  const Real avgCost = std::accumulate(rankCost.begin(), rankCost.end(), 0.0) /
+                       static_cast<Real>(rankCost.size());
+  return (maxCost > 0.0) ? avgCost / maxCost : 1.0;
+}
+
+void
+haloVolume(
+  const BoxArray& a_ba,
+  const DistributionMapping& a_dm,
+  int a_nGrow,
+  const Vector<int>& a_rankNodes,
+  Long& a_total,
+  Long& a_interNode)
+{
+  a_total = 0;
+  a_interNode = 0;
+  const auto& pmap = a_dm.ProcessorMap();
+  std::vector<std::pair<int, Box>> isects;
+  for (int i = 0; i < a_ba.size(); ++i) {
+    a_ba.intersections(amrex::grow(a_ba[i], a_nGrow), isects);
+    for (const auto& [j, bx] : isects) {
+      if (j == i) {
+        continue;
+      }
+      a_total += bx.numPts();
+      if (a_rankNodes[pmap[i]] != a_rankNodes[pmap[j]]) {
+        a_interNode += bx.numPts();
+      }
+    }
+  }
+}
+
+} // namespace NodeLoadBalance
@@ -0,0 +1,104 @@
+#include "PeleLMeX_PerfTrace.H"
+
+#include <AMReX_ParallelDescriptor.H>
+#include <AMReX_Utility.H>
+
+#include <algorithm>
+#include <string>
+
+using namespace amrex;
+
+void
+PerfTrace::open(int a_maxLevel, int a_interval, int a_binary, int a_bufferRows)
+{
+  AMREX_ALWAYS_ASSERT(a_interval > 0);
+  m_active = true;
+  m_interval = a_interval;
+  m_nLevels = a_maxLevel + 1;
+  m_chemTime.resize(m_nLevels, 0.0);
+  m_chemCalls.resize(m_nLevels, 0.0);
+  reset();
+
+  if (ParallelDescriptor::IOProcessor()) {
+    UtilCreateDirectory("temporals", 0755);
+
+    Vector<std::string> cols{"step", "time"};
+    auto addMinAvgMax = [&cols](const std::string& a_name) {
+      for (const auto* stat : {"_min", "_avg", "_max"}) {
+        cols.emplace_back(a_name + stat);
+      }
+    };
+    for (const auto* stage :
+         {"advance", "update", "mac", "scalar_adv", "scalar_diff",
+          "reaction", "velocity"}) {
+      addMinAvgMax(stage);
+    }
+    for (int lev = 0; lev < m_nLevels; ++lev) {
+      const std::string levStr = "_L" + std::to_string(lev);
+      addMinAvgMax("cells" + levStr);
+      addMinAvgMax("chem" + levStr);
+      addMinAvgMax("chem_calls" + levStr);
+    }
+    for (const auto* solver :
+         {"mlmg_mac", "mlmg_scalar", "mlmg_tensor", "mlmg_nodal"}) {
+      cols.emplace_back(solver);
+    }
+    m_file.open("temporals/perfTrace", cols, a_binary, a_bufferRows);
+    if (a_binary == 0) {
+      std::string header{"#"};
+      for (const auto& col : cols) {
+        header += " " + col;
+      }
+      m_file.writeAsciiComment(header);
+    }
+  }
+}
+
+void
+PerfTrace::reset()
+{
+  m_stageTime.fill(0.0);
+  m_solverIters.fill(0);
+  std::fill(m_chemTime.begin(), m_chemTime.end(), 0.0);
+  std::fill(m_chemCalls.begin(), m_chemCalls.end(), 0.0);
+}
+
+void
+PerfTrace::write(int a_step, Real a_time, const Vector<Real>& a_levelCells)
+{
+  if (!m_active) {
+    return;
+  }
+
+  // Pack the rank-local data: stages, then cells, chemistry time and calls
+  // of each level. Levels not present are zero.
+  Vector<Real> local(m_stageTime.begin(), m_stageTime.end());
+  for (int lev = 0; lev < m_nLevels; ++lev) {
+    local.push_back(lev < a_levelCells.size() ? a_levelCells[lev] : 0.0);
+    local.push_back(m_chemTime[lev]);
+    local.push_back(m_chemCalls[lev]);
+  }
+  const int n = static_cast<int>(local.size());
+  Vector<Real> vmin(local);
+  Vector<Real> vmax(local);
+  Vector<Real> vsum(local);
+  const int ioProc = ParallelDescriptor::IOProcessorNumber();
+  ParallelDescriptor::ReduceRealMin(vmin.data(), n, ioProc);
+  ParallelDescriptor::ReduceRealMax(vmax.data(), n, ioProc);
+  ParallelDescriptor::ReduceRealSum(vsum.data(), n, ioProc);
+
+  if (ParallelDescriptor::IOProcessor()) {
+    const Real nprocsInv = 1.0 / ParallelDescriptor::NProcs();
+    Vector<Real> row{static_cast<Real>(a_step), a_time};
+    for (int i = 0; i < n; ++i) {
+      row.push_back(vmin[i]);
+      row.push_back(vsum[i] * nprocsInv);
+      row.push_back(vmax[i]);
+    }
+    // MLMG iterations are the same on all the ranks
+    for (const int iters : m_solverIters) {
+      row.push_back(static_cast<Real>(iters));
+    }
+    m_file.addRow(row);
+  }
+}
@@ -8,6 +8,11 @@
 #include <AMReX_FillPatchUtil.H>
 #include <PeleLMeX_PatchFlowVariables.H>
 #include <memory>
+#include <cstring>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 #ifdef AMREX_USE_EB
 #include <AMReX_EBInterpolater.H>
 #endif
@@ -26,8 +31,62 @@ using namespace amrex;
 
 namespace {
 const std::string level_prefix{"Level_"};
+
+// Hash of the content (including ghost cells) of each FAB of a set of
+// MultiFabs sharing the same BoxArray/DistributionMapping. Each value is
+// mixed with its position into two independent 64-bit hashes, summed over
+// the FAB such that the GPU reduction is order-independent, and the sums of
+// the MultiFabs are chained through a non-linear mix. A change goes
+// undetected only if both 64-bit sums collide: the detection is
+// probabilistic, with a ~2^-128 chance of missing a change.
+AMREX_GPU_HOST_DEVICE AMREX_FORCE_INLINE unsigned long long
+splitmix64(unsigned long long z)
+{
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
 }
 
+void
+hashFabs(
+  const Vector<std::pair<std::string, MultiFab*>>& a_mfs,
+  LayoutData<PeleLM::FabHash>& a_hash)
+{
+  for (MFIter mfi(a_hash); mfi.isValid(); ++mfi) {
+    PeleLM::FabHash hash{0x243F6A8885A308D3ULL, 0x13198A2E03707344ULL};
+    for (int m = 0; m < a_mfs.size(); ++m) {
+      const MultiFab& mf = *a_mfs[m].second;
+      auto const& a = mf.const_array(mfi);
+      const Box gbx = mf.fabbox(mfi.index());
+      const auto lo = amrex::lbound(gbx);
+      const auto len = amrex::length(gbx);
+      ReduceOps<ReduceOpSum, ReduceOpSum> reduce_op;
+      ReduceData<unsigned long long, unsigned long long> reduce_data(reduce_op);
+      using ReduceTuple = typename decltype(reduce_data)::Type;
+      reduce_op.eval(
+        gbx, mf.nComp(), reduce_data,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k, int n) -> ReduceTuple {
+          unsigned long long bits = 0;
+          const Real val = a(i, j, k, n);
+          memcpy(&bits, &val, sizeof(Real));
+          const auto idx = static_cast<unsigned long long>(
+            (i - lo.x) +
+            len.x * ((j - lo.y) + len.y * ((k - lo.z) + len.z * n)));
+          const unsigned long long h0 =
+            splitmix64(bits ^ (idx * 0x9E3779B97F4A7C15ULL));
+          const unsigned long long h1 =
+            splitmix64(h0 ^ bits ^ (idx * 0xD6E8FEB86659FD93ULL + 1ULL));
+          return {h0, h1};
+        });
+      auto hv = reduce_data.value(reduce_op);
+      hash[0] = splitmix64(hash[0] ^ amrex::get<0>(hv)) + m;
+      hash[1] = splitmix64(hash[1] ^ amrex::get<1>(hv) ^ hash[0]);
+    }
+    a_hash[mfi] = hash;
+  }
+}
+} // namespace
+
 void
 GotoNextLine(std::istream& is)
 {
@@ -82,86 +141,6 @@ PeleLM::WritePlotFile()
     averageDownReaction();
   }
 
-  //----------------------------------------------------------------
-  // Number of components
-  int ncomp = 0;
-
-  // State
-  if (m_incompressible != 0) {
-    // Velocity + pressure gradients
-    ncomp = 2 * AMREX_SPACEDIM;
-  } else {
-    // State + pressure gradients
-    if (m_plot_grad_p != 0) {
-      ncomp = NVAR + AMREX_SPACEDIM;
-    } else {
-      ncomp = NVAR;
-    }
-    // Make the plot lighter by dropping species by default
-    if (m_plotStateSpec == 0) {
-      ncomp -= NUM_SPECIES;
-    }
-    if (m_has_divu != 0) {
-      ncomp += 1;
-    }
-  }
-
-  // Reactions
-  if ((m_do_react != 0) && (m_skipInstantRR == 0) && (m_plot_react != 0)) {
-    // Cons Rate
-    ncomp += nCompIR();
-    // FunctCall
-    ncomp += 1;
-    // Extras:
-    if (m_plotHeatRelease != 0) {
-      ncomp += 1;
-    }
-  }
-
-#ifdef AMREX_USE_EB
-  // Include volume fraction in plotfile
-  ncomp += 1;
-#endif
-
-#ifdef PELE_USE_RADIATION
-  if (do_rad_solve) {
-    ncomp += 3;
-  }
-#endif
-
-  // Derive
-  int deriveEntryCount = 0;
-  for (int ivar = 0; ivar < m_derivePlotVarCount; ivar++) {
-    const PeleLMDeriveRec* rec = derive_lst.get(m_derivePlotVars[ivar]);
-    deriveEntryCount += rec->numDerive();
-  }
-  ncomp += deriveEntryCount;
-#ifdef PELE_USE_SPRAY
-  if (do_spray_particles) {
-    ncomp += SprayParticleContainer::NumDeriveVars();
-    if (SprayParticleContainer::plot_spray_src) {
-      ncomp += AMREX_SPACEDIM + 2 + SPRAY_FUEL_NUM;
-    }
-  }
-#endif
-
-#ifdef PELE_USE_EFIELD
-  if (m_do_extraEFdiags) {
-    ncomp += NUM_IONS * AMREX_SPACEDIM;
-  }
-#endif
-
-  if (m_do_les && m_plot_les) {
-    ncomp += 1;
-  }
-
-  //----------------------------------------------------------------
-  // Plot MultiFabs
-  Vector<MultiFab> mf_plt(finest_level + 1);
-  for (int lev = 0; lev <= finest_level; ++lev) {
-    mf_plt[lev].define(grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
-  }
-
   //----------------------------------------------------------------
   // Components names
   Vector<std::string> names;
@@ -271,172 +250,284 @@ PeleLM::WritePlotFile()
     plt_VarsName.push_back("viscturb");
   }
 
+  if ((m_do_stats != 0) && (m_statsTime > 0.0)) {
+    for (const auto& var : m_statsVars) {
+      plt_VarsName.push_back("mean_" + var);
+      plt_VarsName.push_back("rms_" + var);
+      plt_VarsName.push_back("favre_mean_" + var);
+      plt_VarsName.push_back("favre_rms_" + var);
+    }
+  }
+
   //----------------------------------------------------------------
-  // Fill the plot MultiFabs
-  for (int lev = 0; lev <= finest_level; ++lev) {
-    int cnt = 0;
-    if (m_incompressible != 0) {
-      MultiFab::Copy(
-        mf_plt[lev], m_leveldata_new[lev]->state, 0, cnt, AMREX_SPACEDIM, 0);
-      cnt += AMREX_SPACEDIM;
-    } else {
-      // Velocity and density
-      MultiFab::Copy(
-        mf_plt[lev], m_leveldata_new[lev]->state, 0, cnt, AMREX_SPACEDIM + 1,
-        0);
-      cnt += AMREX_SPACEDIM + 1;
-      // Species only if requested
-      if (m_plotStateSpec != 0) {
-        MultiFab::Copy(
-          mf_plt[lev], m_leveldata_new[lev]->state, FIRSTSPEC, cnt, NUM_SPECIES,
-          0);
-        cnt += NUM_SPECIES;
-      }
-      MultiFab::Copy(mf_plt[lev], m_leveldata_new[lev]->state, RHOH, cnt, 3, 0);
-      cnt += 3;
+  // Plot variable groups, in the order of the names above
+  Vector<PlotVarGroup> groups;
+  auto addCopyGroup = [&groups](
+                        std::function<const MultiFab&(int)> a_src,
+                        int a_scomp, int a_ncomp) {
+    groups.push_back(
+      {a_ncomp, true,
+       [a_src, a_scomp](
+         int lev, MultiFab& a_mf, int a_dcomp, int a_gcomp, int a_n) {
+         MultiFab::Copy(a_mf, a_src(lev), a_scomp + a_gcomp, a_dcomp, a_n, 0);
+       }});
+  };
+  auto newState = [this](int lev) -> const MultiFab& {
+    return m_leveldata_new[lev]->state;
+  };
+
+  if (m_incompressible != 0) {
+    addCopyGroup(newState, 0, AMREX_SPACEDIM);
+  } else {
+    // Velocity and density
+    addCopyGroup(newState, 0, AMREX_SPACEDIM + 1);
+    // Species only if requested
+    if (m_plotStateSpec != 0) {
+      addCopyGroup(newState, FIRSTSPEC, NUM_SPECIES);
+    }
+    addCopyGroup(newState, RHOH, 3);
 #ifdef PELE_USE_EFIELD
-      MultiFab::Copy(mf_plt[lev], m_leveldata_new[lev]->state, NE, cnt, 2, 0);
-      cnt += 2;
+    addCopyGroup(newState, NE, 2);
 #endif
 #ifdef PELE_USE_SOOT
-      MultiFab::Copy(
-        mf_plt[lev], m_leveldata_new[lev]->state, FIRSTSOOT, cnt, NUMSOOTVAR,
-        0);
-      cnt += NUMSOOTVAR;
+    addCopyGroup(newState, FIRSTSOOT, NUMSOOTVAR);
 #endif
 #ifdef PELE_USE_RADIATION
-      if (do_rad_solve) {
-        MultiFab::Copy(mf_plt[lev], rad_model->G()[lev], 0, cnt, 1, 0);
-        cnt += 1;
-        MultiFab::Copy(mf_plt[lev], rad_model->kappa()[lev], 0, cnt, 1, 0);
-        cnt += 1;
-        MultiFab::Copy(mf_plt[lev], rad_model->emis()[lev], 0, cnt, 1, 0);
-        cnt += 1;
-      }
-#endif
-      if (m_has_divu != 0) {
-        MultiFab::Copy(mf_plt[lev], m_leveldata_new[lev]->divu, 0, cnt, 1, 0);
-        cnt += 1;
-      }
+    if (do_rad_solve) {
+      addCopyGroup(
+        [this](int lev) -> const MultiFab& { return rad_model->G()[lev]; }, 0,
+        1);
+      addCopyGroup(
+        [this](int lev) -> const MultiFab& { return rad_model->kappa()[lev]; },
+        0, 1);
+      addCopyGroup(
+        [this](int lev) -> const MultiFab& { return rad_model->emis()[lev]; },
+        0, 1);
     }
-    if (m_plot_grad_p != 0) {
-      MultiFab::Copy(
-        mf_plt[lev], m_leveldata_new[lev]->gp, 0, cnt, AMREX_SPACEDIM, 0);
-      cnt += AMREX_SPACEDIM;
+#endif
+    if (m_has_divu != 0) {
+      addCopyGroup(
+        [this](int lev) -> const MultiFab& {
+          return m_leveldata_new[lev]->divu;
+        },
+        0, 1);
     }
+  }
+  if (m_plot_grad_p != 0) {
+    addCopyGroup(
+      [this](int lev) -> const MultiFab& { return m_leveldata_new[lev]->gp; },
+      0, AMREX_SPACEDIM);
+  }
 
-    if ((m_do_react != 0) && (m_skipInstantRR == 0) && (m_plot_react != 0)) {
-      MultiFab::Copy(
-        mf_plt[lev], m_leveldatareact[lev]->I_R, 0, cnt, nCompIR(), 0);
-      cnt += nCompIR();
-
-      MultiFab::Copy(mf_plt[lev], m_leveldatareact[lev]->functC, 0, cnt, 1, 0);
-      cnt += 1;
-
-      if (m_plotHeatRelease != 0) {
-        std::unique_ptr<MultiFab> mf;
-        mf = std::make_unique<MultiFab>(grids[lev], dmap[lev], 1, 0);
-        getHeatRelease(lev, mf.get());
-        MultiFab::Copy(mf_plt[lev], *mf, 0, cnt, 1, 0);
-        cnt += 1;
-      }
+  if ((m_do_react != 0) && (m_skipInstantRR == 0) && (m_plot_react != 0)) {
+    addCopyGroup(
+      [this](int lev) -> const MultiFab& { return m_leveldatareact[lev]->I_R; },
+      0, nCompIR());
+    addCopyGroup(
+      [this](int lev) -> const MultiFab& {
+        return m_leveldatareact[lev]->functC;
+      },
+      0, 1);
+    if (m_plotHeatRelease != 0) {
+      groups.push_back(
+        {1, false, [this](int lev, MultiFab& a_mf, int a_dcomp, int, int) {
+           MultiFab mf(grids[lev], dmap[lev], 1, 0);
+           getHeatRelease(lev, &mf);
+           MultiFab::Copy(a_mf, mf, 0, a_dcomp, 1, 0);
+         },
+         1});
     }
+  }
 
 #ifdef AMREX_USE_EB
-    MultiFab::Copy(mf_plt[lev], EBFactory(lev).getVolFrac(), 0, cnt, 1, 0);
-    cnt += 1;
+  addCopyGroup(
+    [this](int lev) -> const MultiFab& {
+      return EBFactory(lev).getVolFrac();
+    },
+    0, 1);
 #endif
 
-    for (int ivar = 0; ivar < m_derivePlotVarCount; ivar++) {
-      std::unique_ptr<MultiFab> mf;
-      mf = derive(m_derivePlotVars[ivar], m_cur_time, lev, 0);
-      MultiFab::Copy(mf_plt[lev], *mf, 0, cnt, mf->nComp(), 0);
-      cnt += mf->nComp();
-    }
+  for (int ivar = 0; ivar < m_derivePlotVarCount; ivar++) {
+    const PeleLMDeriveRec* rec = derive_lst.get(m_derivePlotVars[ivar]);
+    const std::string& dname = m_derivePlotVars[ivar];
+    groups.push_back(
+      {rec->numDerive(), false,
+       [this, dname](int lev, MultiFab& a_mf, int a_dcomp, int, int) {
+         std::unique_ptr<MultiFab> mf = derive(dname, m_cur_time, lev, 0);
+         MultiFab::Copy(a_mf, *mf, 0, a_dcomp, mf->nComp(), 0);
+       },
+       // Derived data, filled state and reaction data
+       rec->numDerive() + NVAR + ((m_do_react != 0) ? nCompIR() : 0)});
+  }
 #ifdef PELE_USE_SPRAY
-    if (SprayParticleContainer::NumDeriveVars() > 0) {
-      const int num_spray_derive = SprayParticleContainer::NumDeriveVars();
-      mf_plt[lev].setVal(0., cnt, num_spray_derive);
-      SprayPC->computeDerivedVars(mf_plt[lev], lev, cnt);
-      if (lev < finest_level) {
-        MultiFab tmp_plt(
-          grids[lev], dmap[lev], num_spray_derive, 0, MFInfo(), Factory(lev));
-        tmp_plt.setVal(0.);
-        VirtPC->computeDerivedVars(tmp_plt, lev, 0);
-        MultiFab::Add(mf_plt[lev], tmp_plt, 0, cnt, num_spray_derive, 0);
-      }
-      cnt += num_spray_derive;
-    }
-    if (do_spray_particles && SprayParticleContainer::plot_spray_src) {
-      SprayComps scomps = SprayParticleContainer::getSprayComps();
-      MultiFab::Copy(
-        mf_plt[lev], *m_spraysource[lev], scomps.rhoSrcIndx, cnt++, 1, 0);
-      MultiFab::Copy(
-        mf_plt[lev], *m_spraysource[lev], scomps.engSrcIndx, cnt++, 1, 0);
-      MultiFab::Copy(
-        mf_plt[lev], *m_spraysource[lev], scomps.momSrcIndx, cnt,
-        AMREX_SPACEDIM, 0);
-      cnt += AMREX_SPACEDIM;
-      for (int spf = 0; spf < SPRAY_FUEL_NUM; ++spf) {
-        MultiFab::Copy(
-          mf_plt[lev], *m_spraysource[lev], scomps.specSrcIndx + spf, cnt++, 1,
-          0);
-      }
+  if (SprayParticleContainer::NumDeriveVars() > 0) {
+    const int num_spray_derive = SprayParticleContainer::NumDeriveVars();
+    groups.push_back(
+      {num_spray_derive, false,
+       [this, num_spray_derive](
+         int lev, MultiFab& a_mf, int a_dcomp, int, int) {
+         a_mf.setVal(0., a_dcomp, num_spray_derive);
+         SprayPC->computeDerivedVars(a_mf, lev, a_dcomp);
+         if (lev < finest_level) {
+           MultiFab tmp_plt(
+             grids[lev], dmap[lev], num_spray_derive, 0, MFInfo(),
+             Factory(lev));
+           tmp_plt.setVal(0.);
+           VirtPC->computeDerivedVars(tmp_plt, lev, 0);
+           MultiFab::Add(a_mf, tmp_plt, 0, a_dcomp, num_spray_derive, 0);
+         }
+       },
+       num_spray_derive});
+  }
+  if (do_spray_particles && SprayParticleContainer::plot_spray_src) {
+    SprayComps scomps = SprayParticleContainer::getSprayComps();
+    auto spraySrc = [this](int lev) -> const MultiFab& {
+      return *m_spraysource[lev];
+    };
+    addCopyGroup(spraySrc, scomps.rhoSrcIndx, 1);
+    addCopyGroup(spraySrc, scomps.engSrcIndx, 1);
+    addCopyGroup(spraySrc, scomps.momSrcIndx, AMREX_SPACEDIM);
+    for (int spf = 0; spf < SPRAY_FUEL_NUM; ++spf) {
+      addCopyGroup(spraySrc, scomps.specSrcIndx + spf, 1);
     }
+  }
 #endif
 #ifdef PELE_USE_EFIELD
-    if (m_do_extraEFdiags) {
-      MultiFab::Copy(
-        mf_plt[lev], *m_ionsFluxes[lev], 0, cnt, m_ionsFluxes[lev]->nComp(), 0);
-      cnt += m_ionsFluxes[lev]->nComp();
-    }
+  if (m_do_extraEFdiags) {
+    addCopyGroup(
+      [this](int lev) -> const MultiFab& { return *m_ionsFluxes[lev]; }, 0,
+      NUM_IONS * AMREX_SPACEDIM);
+  }
 #endif
 
-    if (m_do_les && m_plot_les) {
-      constexpr amrex::Real fact = 0.5 / AMREX_SPACEDIM;
-      auto const& plot_arr = mf_plt[lev].arrays();
-      AMREX_D_TERM(auto const& mut_arr_x =
-                     m_leveldata_old[lev]->visc_turb_fc[0].const_arrays();
-                   , auto const& mut_arr_y =
-                       m_leveldata_old[lev]->visc_turb_fc[1].const_arrays();
-                   , auto const& mut_arr_z =
-                       m_leveldata_old[lev]->visc_turb_fc[2].const_arrays();)
-      // interpolate turbulent viscosity from faces to centers
-      amrex::ParallelFor(
-        mf_plt[lev],
-        [plot_arr, AMREX_D_DECL(mut_arr_x, mut_arr_y, mut_arr_z),
-         cnt] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
-          plot_arr[box_no](i, j, k, cnt) =
-            fact *
-            (AMREX_D_TERM(
-              mut_arr_x[box_no](i, j, k) + mut_arr_x[box_no](i + 1, j, k),
-              +mut_arr_y[box_no](i, j, k) + mut_arr_y[box_no](i, j + 1, k),
-              +mut_arr_z[box_no](i, j, k) + mut_arr_z[box_no](i, j, k + 1)));
-        });
-      Gpu::streamSynchronize();
-    }
+  if (m_do_les && m_plot_les) {
+    groups.push_back(
+      {1, false, [this](int lev, MultiFab& a_mf, int a_dcomp, int, int) {
+         constexpr amrex::Real fact = 0.5 / AMREX_SPACEDIM;
+         auto const& plot_arr = a_mf.arrays();
+         AMREX_D_TERM(auto const& mut_arr_x =
+                        m_leveldata_old[lev]->visc_turb_fc[0].const_arrays();
+                      , auto const& mut_arr_y =
+                          m_leveldata_old[lev]->visc_turb_fc[1].const_arrays();
+                      , auto const& mut_arr_z =
+                          m_leveldata_old[lev]->visc_turb_fc[2].const_arrays();)
+         // interpolate turbulent viscosity from faces to centers
+         amrex::ParallelFor(
+           a_mf, [plot_arr, AMREX_D_DECL(mut_arr_x, mut_arr_y, mut_arr_z),
+                  a_dcomp] AMREX_GPU_DEVICE(
+                   int box_no, int i, int j, int k) noexcept {
+             plot_arr[box_no](i, j, k, a_dcomp) =
+               fact *
+               (AMREX_D_TERM(
+                 mut_arr_x[box_no](i, j, k) + mut_arr_x[box_no](i + 1, j, k),
+                 +mut_arr_y[box_no](i, j, k) + mut_arr_y[box_no](i, j + 1, k),
+                 +mut_arr_z[box_no](i, j, k) + mut_arr_z[box_no](i, j, k + 1)));
+           });
+         Gpu::streamSynchronize();
+       }});
+  }
 
-#ifdef AMREX_USE_EB
-    if (m_plot_zeroEBcovered != 0) {
-      EB_set_covered(mf_plt[lev], 0.0);
-    }
-#endif
+  if ((m_do_stats != 0) && (m_statsTime > 0.0)) {
+    groups.push_back(
+      {4 * static_cast<int>(m_statsVars.size()), false,
+       [this](int lev, MultiFab& a_mf, int a_dcomp, int, int) {
+         getStatistics(lev, a_mf, a_dcomp);
+       }});
   }
 
+  int ncomp = 0;
+  for (const auto& group : groups) {
+    ncomp += group.ncomp;
+  }
+  AMREX_ALWAYS_ASSERT(ncomp == static_cast<int>(plt_VarsName.size()));
+
   // No SubCycling, all levels the same step.
   Vector<int> istep(finest_level + 1, m_nstep);
 
+  //----------------------------------------------------------------
+  // Stream the plotfile when assembling all the plot variables at once
+  // would exceed the memory budget (native binary plotfiles only)
+  bool streamPlot = false;
+  const FABio::Format nativeFormat = FArrayBox::getFormat();
+  if (
+    m_plotMemBudget > 0.0 && !m_write_hdf5_pltfile &&
+    nativeFormat != FABio::FAB_ASCII && nativeFormat != FABio::FAB_8BIT) {
+    Long localCells = 0;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      for (int i = 0; i < grids[lev].size(); ++i) {
+        if (dmap[lev][i] == ParallelDescriptor::MyProc()) {
+          localCells += grids[lev][i].numPts();
+        }
+      }
+    }
+    ParallelDescriptor::ReduceLongMax(localCells);
+    const Real pltBytes = static_cast<Real>(localCells) *
+                          static_cast<Real>(ncomp) * sizeof(Real);
+    streamPlot = (pltBytes > m_plotMemBudget * 1024.0 * 1024.0);
+  }
+
+  // Single precision: data are converted on the fly when writing the FABs
+  if (m_plotSinglePrecision != 0) {
+    FArrayBox::setFormat(FABio::FAB_NATIVE_32);
+  }
+
+  Vector<Real> lossySteps;
+  Vector<Real> lossyErr;
+  if (streamPlot) {
+    lossySteps = WritePlotFileStreamed(
+      plotfilename, groups, plt_VarsName, istep, lossyErr);
+  } else {
+    //----------------------------------------------------------------
+    // Plot MultiFabs
+    Vector<MultiFab> mf_plt(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      mf_plt[lev].define(
+        grids[lev], dmap[lev], ncomp, 0, MFInfo(), Factory(lev));
+      int cnt = 0;
+      for (const auto& group : groups) {
+        group.fill(lev, mf_plt[lev], cnt, 0, group.ncomp);
+        cnt += group.ncomp;
+      }
+#ifdef AMREX_USE_EB
+      if (m_plot_zeroEBcovered != 0) {
+        EB_set_covered(mf_plt[lev], 0.0);
+      }
+#endif
+    }
+
+    // Error-bounded quantization of the requested variables
+    lossySteps = applyPlotLossyBounds(mf_plt, plt_VarsName, lossyErr);
+
 #ifdef AMREX_USE_HDF5
-  if (m_write_hdf5_pltfile) {
-    amrex::WriteMultiLevelPlotfileHDF5(
-      plotfilename, finest_level + 1, GetVecOfConstPtrs(mf_plt), plt_VarsName,
-      Geom(), m_cur_time, istep, refRatio());
-  } else
+    if (m_write_hdf5_pltfile) {
+      amrex::WriteMultiLevelPlotfileHDF5(
+        plotfilename, finest_level + 1, GetVecOfConstPtrs(mf_plt),
+        plt_VarsName, Geom(), m_cur_time, istep, refRatio());
+    } else
 #endif
-  {
-    amrex::WriteMultiLevelPlotfile(
-      plotfilename, finest_level + 1, GetVecOfConstPtrs(mf_plt), plt_VarsName,
-      Geom(), m_cur_time, istep, refRatio());
+    {
+      if (m_aggWriter) {
+        // Node-aggregated data files, same layout
+        WritePlotFileHeader(plotfilename, plt_VarsName, istep);
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          m_aggWriter->write(
+            mf_plt[lev], amrex::MultiFabFileFullPrefix(
+                           lev, plotfilename, level_prefix, "Cell"));
+        }
+        m_aggWriter->drain();
+      } else {
+        amrex::WriteMultiLevelPlotfile(
+          plotfilename, finest_level + 1, GetVecOfConstPtrs(mf_plt),
+          plt_VarsName, Geom(), m_cur_time, istep, refRatio());
+      }
+    }
+  }
+  FArrayBox::setFormat(nativeFormat);
+
+  if (
+    m_plotPrecision != "double" || !m_plotPrecisionVars.empty() ||
+    !m_plotLossyVars.empty()) {
+    WritePlotPrecisionHeader(plotfilename, plt_VarsName, lossySteps, lossyErr);
   }
 
 #ifdef PELE_USE_SPRAY
@@ -451,6 +542,490 @@ PeleLM::WritePlotFile()
 #endif
 }
 
+void
+PeleLM::WritePlotFileHeader(
+  const std::string& a_pltfile,
+  const Vector<std::string>& a_names,
+  const Vector<int>& a_istep) const
+{
+  const int nlevs = finest_level + 1;
+  PreBuildDirectorHierarchy(a_pltfile, level_prefix, nlevs, true);
+  if (ParallelDescriptor::IOProcessor()) {
+    Vector<BoxArray> boxArrays(nlevs);
+    for (int lev = 0; lev < nlevs; ++lev) {
+      boxArrays[lev] = grids[lev];
+    }
+    VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+    std::string HeaderFileName(a_pltfile + "/Header");
+    std::ofstream HeaderFile;
+    HeaderFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+    HeaderFile.open(
+      HeaderFileName.c_str(),
+      std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+    if (!HeaderFile.good()) {
+      amrex::FileOpenFailed(HeaderFileName);
+    }
+    WriteGenericPlotfileHeader(
+      HeaderFile, nlevs, boxArrays, a_names, Geom(), m_cur_time, a_istep,
+      refRatio(), "HyperCLaw-V1.1", level_prefix, "Cell");
+  }
+}
+
+Vector<Real>
+PeleLM::WritePlotFileStreamed(
+  const std::string& a_pltfile,
+  const Vector<PlotVarGroup>& a_groups,
+  const Vector<std::string>& a_names,
+  const Vector<int>& a_istep,
+  Vector<Real>& a_maxErr)
+{
+  BL_PROFILE("PeleLMeX::WritePlotFileStreamed()");
+
+  const int nlevs = finest_level + 1;
+  const int ncomp = static_cast<int>(a_names.size());
+  const int myProc = ParallelDescriptor::MyProc();
+  const int ioProc = ParallelDescriptor::IOProcessorNumber();
+  const int nFiles =
+    std::max(1, std::min(VisMF::GetNOutFiles(), ParallelDescriptor::NProcs()));
+  const std::string levelPrefix{"Level_"};
+  const std::string mfPrefix{"Cell"};
+
+  //----------------------------------------------------------------
+  // Directories and plotfile Header
+  WritePlotFileHeader(a_pltfile, a_names, a_istep);
+
+  //----------------------------------------------------------------
+  // On-disk size of a value in the current FAB format
+  const FABio& fabio = FArrayBox::getFABio();
+  Long bytesPerVal = 0;
+  {
+    FArrayBox probe(Box(IntVect(0), IntVect(0)), 1, The_Cpu_Arena());
+    probe.setVal<RunOn::Host>(0.0);
+    std::ostringstream os;
+    fabio.write(os, probe, 0, 1);
+    bytesPerVal = static_cast<Long>(os.str().size());
+  }
+
+  //----------------------------------------------------------------
+  // Layout of the data files, identical on all the ranks: the FABs of
+  // rank p go to file p % nFiles, in BoxArray order. Each FAB is its header
+  // followed by the data of all the plot variables, component by component,
+  // such that each batch of variables is written in place.
+  Vector<Vector<Long>> fabOffset(nlevs);
+  Vector<Vector<Long>> dataOffset(nlevs);
+  Vector<VisMF::Header> cellHeaders(nlevs);
+  for (int lev = 0; lev < nlevs; ++lev) {
+    const BoxArray& ba = grids[lev];
+    const DistributionMapping& dm = dmap[lev];
+    const int nfabs = static_cast<int>(ba.size());
+    const std::string prefix =
+      MultiFabFileFullPrefix(lev, a_pltfile, levelPrefix, mfPrefix);
+    fabOffset[lev].resize(nfabs);
+    dataOffset[lev].resize(nfabs);
+    Vector<Long> fileSize(nFiles, 0);
+    Vector<std::pair<Long, std::string>> myFabHeaders;
+    for (int i = 0; i < nfabs; ++i) {
+      const int file = dm[i] % nFiles;
+      FArrayBox hdrFab(ba[i], ncomp, false);
+      std::ostringstream os;
+      fabio.write_header(os, hdrFab, ncomp);
+      fabOffset[lev][i] = fileSize[file];
+      dataOffset[lev][i] = fileSize[file] + static_cast<Long>(os.str().size());
+      fileSize[file] =
+        dataOffset[lev][i] + ba[i].numPts() * ncomp * bytesPerVal;
+      if (file == myProc) {
+        myFabHeaders.emplace_back(fabOffset[lev][i], os.str());
+      }
+    }
+
+    // Rank p < nFiles creates file p and writes its FAB headers
+    if (myProc < nFiles) {
+      const std::string fileName =
+        amrex::Concatenate(prefix + "_D_", myProc, 5);
+      std::ofstream fs(
+        fileName.c_str(),
+        std::ofstream::out | std::ofstream::trunc | std::ofstream::binary);
+      if (!fs.good()) {
+        amrex::FileOpenFailed(fileName);
+      }
+      for (const auto& fabHeader : myFabHeaders) {
+        fs.seekp(fabHeader.first, std::ios::beg);
+        fs.write(fabHeader.second.data(), fabHeader.second.size());
+      }
+    }
+
+    if (ParallelDescriptor::IOProcessor()) {
+      VisMF::Header& hdr = cellHeaders[lev];
+      hdr.m_vers = VisMF::Header::Version_v1;
+      hdr.m_how = VisMF::NFiles;
+      hdr.m_ncomp = ncomp;
+      hdr.m_ngrow = IntVect(0);
+      hdr.m_ba = ba;
+      hdr.m_fod.resize(nfabs);
+      for (int i = 0; i < nfabs; ++i) {
+        hdr.m_fod[i] = VisMF::FabOnDisk(
+          amrex::Concatenate(mfPrefix + "_D_", dm[i] % nFiles, 5),
+          fabOffset[lev][i]);
+      }
+      hdr.m_min.resize(nfabs, Vector<Real>(ncomp, 0.0));
+      hdr.m_max.resize(nfabs, Vector<Real>(ncomp, 0.0));
+    }
+  }
+  ParallelDescriptor::Barrier();
+
+  //----------------------------------------------------------------
+  // Batches of consecutive variables fitting the memory budget, counting
+  // the temporaries allocated when filling the largest group of the batch.
+  // A group that can't be split larger than the budget gets its own batch.
+  Long maxLocalCells = 0;
+  Long maxLocalTmpCells = 0;
+  for (int lev = 0; lev < nlevs; ++lev) {
+    for (int i = 0; i < grids[lev].size(); ++i) {
+      if (dmap[lev][i] == myProc) {
+        maxLocalCells += grids[lev][i].numPts();
+        maxLocalTmpCells += amrex::grow(grids[lev][i], m_nGrowState).numPts();
+      }
+    }
+  }
+  ParallelDescriptor::ReduceLongMax(maxLocalCells);
+  ParallelDescriptor::ReduceLongMax(maxLocalTmpCells);
+  const Real budgetBytes = m_plotMemBudget * 1024.0 * 1024.0;
+  const Real compBytes =
+    static_cast<Real>(std::max(maxLocalCells, Long(1))) * sizeof(Real);
+  const Real tmpCompBytes = static_cast<Real>(maxLocalTmpCells) * sizeof(Real);
+
+  struct PlotPiece
+  {
+    int group;
+    int gcomp;
+    int ncomp;
+  };
+  Vector<Vector<PlotPiece>> batches(1);
+  int batchFill = 0;
+  int batchTmp = 0;
+  for (int g = 0; g < a_groups.size(); ++g) {
+    int gcomp = 0;
+    while (gcomp < a_groups[g].ncomp) {
+      const int tmp = std::max(batchTmp, a_groups[g].tmpComp);
+      const int avail =
+        static_cast<int>((budgetBytes - tmp * tmpCompBytes) / compBytes) -
+        batchFill;
+      int n = a_groups[g].splittable
+                ? std::min(avail, a_groups[g].ncomp - gcomp)
+                : a_groups[g].ncomp;
+      if ((avail <= 0 || n > avail) && batchFill > 0) {
+        batches.emplace_back();
+        batchFill = 0;
+        batchTmp = 0;
+        continue;
+      }
+      // Alone in its batch and still over budget
+      if (n <= 0) {
+        n = 1;
+      }
+      batches.back().push_back({g, gcomp, n});
+      batchFill += n;
+      batchTmp = tmp;
+      gcomp += n;
+    }
+  }
+
+  if (m_verbose > 1) {
+    Print() << "   Streaming plotfile in " << batches.size() << " batches\n";
+  }
+
+  //----------------------------------------------------------------
+  // Assemble, quantize and write each batch in place
+  Vector<Real> steps(ncomp, 0.0);
+  a_maxErr.assign(ncomp, 0.0);
+  int batchStart = 0;
+  for (const auto& batch : batches) {
+    int batchN = 0;
+    for (const auto& piece : batch) {
+      batchN += piece.ncomp;
+    }
+    if (batchN == 0) {
+      continue;
+    }
+
+    Vector<MultiFab> mf_batch(nlevs);
+    for (int lev = 0; lev < nlevs; ++lev) {
+      mf_batch[lev].define(
+        grids[lev], dmap[lev], batchN, 0, MFInfo(), Factory(lev));
+      int cnt = 0;
+      for (const auto& piece : batch) {
+        a_groups[piece.group].fill(
+          lev, mf_batch[lev], cnt, piece.gcomp, piece.ncomp);
+        cnt += piece.ncomp;
+      }
+#ifdef AMREX_USE_EB
+      if (m_plot_zeroEBcovered != 0) {
+        EB_set_covered(mf_batch[lev], 0.0);
+      }
+#endif
+    }
+
+    Vector<std::string> batchNames(
+      a_names.begin() + batchStart, a_names.begin() + batchStart + batchN);
+    Vector<Real> batchErr;
+    Vector<Real> batchSteps =
+      applyPlotLossyBounds(mf_batch, batchNames, batchErr, false);
+    for (int n = 0; n < batchN; ++n) {
+      steps[batchStart + n] = batchSteps[n];
+      a_maxErr[batchStart + n] = batchErr[n];
+    }
+
+    for (int lev = 0; lev < nlevs; ++lev) {
+      const int nfabs = static_cast<int>(grids[lev].size());
+      Vector<Real> fabMin(static_cast<Long>(nfabs) * batchN, 0.0);
+      Vector<Real> fabMax(static_cast<Long>(nfabs) * batchN, 0.0);
+
+      // The ranks sharing a data file write one at a time, in rank order,
+      // so that at most nFiles ranks write at once, as in VisMF
+      const int handoffTag = ParallelDescriptor::SeqNum();
+      if (myProc >= nFiles) {
+        int token = 0;
+        ParallelDescriptor::Recv(&token, 1, myProc - nFiles, handoffTag);
+      }
+      if (mf_batch[lev].local_size() > 0) {
+        const std::string fileName = amrex::Concatenate(
+          MultiFabFileFullPrefix(lev, a_pltfile, levelPrefix, mfPrefix) +
+            "_D_",
+          myProc % nFiles, 5);
+        std::fstream fs(
+          fileName.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+        if (!fs.good()) {
+          amrex::FileOpenFailed(fileName);
+        }
+        for (MFIter mfi(mf_batch[lev]); mfi.isValid(); ++mfi) {
+          const int i = mfi.index();
+          const Box& bx = mfi.validbox();
+#ifdef AMREX_USE_GPU
+          FArrayBox hostFab(bx, batchN, The_Pinned_Arena());
+          hostFab.copy<RunOn::Device>(mf_batch[lev][mfi], bx, 0, bx, 0, batchN);
+          Gpu::streamSynchronize();
+#else
+          const FArrayBox& hostFab = mf_batch[lev][mfi];
+#endif
+          fs.seekp(
+            dataOffset[lev][i] + batchStart * bx.numPts() * bytesPerVal,
+            std::ios::beg);
+          fabio.write(fs, hostFab, 0, batchN);
+          for (int n = 0; n < batchN; ++n) {
+            fabMin[static_cast<Long>(i) * batchN + n] =
+              hostFab.min<RunOn::Host>(bx, n);
+            fabMax[static_cast<Long>(i) * batchN + n] =
+              hostFab.max<RunOn::Host>(bx, n);
+          }
+        }
+        fs.flush();
+        if (!fs.good()) {
+          amrex::Abort("Failed to write plotfile data to " + fileName);
+        }
+      }
+      if (myProc + nFiles < ParallelDescriptor::NProcs()) {
+        int token = 0;
+        ParallelDescriptor::Send(&token, 1, myProc + nFiles, handoffTag);
+      }
+
+      // Each FAB min/max is set by its owner only
+      ParallelDescriptor::ReduceRealSum(
+        fabMin.data(), static_cast<int>(fabMin.size()), ioProc);
+      ParallelDescriptor::ReduceRealSum(
+        fabMax.data(), static_cast<int>(fabMax.size()), ioProc);
+      if (ParallelDescriptor::IOProcessor()) {
+        for (int i = 0; i < nfabs; ++i) {
+          for (int n = 0; n < batchN; ++n) {
+            cellHeaders[lev].m_min[i][batchStart + n] =
+              fabMin[static_cast<Long>(i) * batchN + n];
+            cellHeaders[lev].m_max[i][batchStart + n] =
+              fabMax[static_cast<Long>(i) * batchN + n];
+          }
+        }
+      }
+    }
+    batchStart += batchN;
+  }
+
+  //----------------------------------------------------------------
+  // MultiFab headers
+  if (ParallelDescriptor::IOProcessor()) {
+    for (int lev = 0; lev < nlevs; ++lev) {
+      const std::string hdrName =
+        MultiFabFileFullPrefix(lev, a_pltfile, levelPrefix, mfPrefix) + "_H";
+      VisMF::IO_Buffer io_buffer(VisMF::IO_Buffer_Size);
+      std::ofstream hdrFile;
+      hdrFile.rdbuf()->pubsetbuf(io_buffer.dataPtr(), io_buffer.size());
+      hdrFile.open(
+        hdrName.c_str(), std::ofstream::out | std::ofstream::trunc);
+      if (!hdrFile.good()) {
+        amrex::FileOpenFailed(hdrName);
+      }
+      hdrFile << cellHeaders[lev];
+    }
+  }
+  ParallelDescriptor::Barrier();
+
+  // Check for unused lossy variables once over the full list
+  if (!m_plotLossyVars.empty() && m_verbose > 0) {
+    for (const auto& lossyVar : m_plotLossyVars) {
+      if (
+        std::find(a_names.begin(), a_names.end(), lossyVar) == a_names.end()) {
+        Print() << " WARNING: lossy plot variable " << lossyVar
+                << " not found in the plot variables, skipping it\n";
+      }
+    }
+  }
+
+  return steps;
+}
+
+Vector<Real>
+PeleLM::applyPlotLossyBounds(
+  Vector<MultiFab>& a_mf,
+  const Vector<std::string>& a_names,
+  Vector<Real>& a_maxErr,
+  bool a_warnMissing)
+{
+  Vector<Real> steps(a_names.size(), 0.0);
+  a_maxErr.assign(a_names.size(), 0.0);
+  if (
+    m_plotLossyVars.empty() && m_plotPrecision == "double" &&
+    m_plotPrecisionVars.empty()) {
+    return steps;
+  }
+
+  BL_PROFILE("PeleLMeX::applyPlotLossyBounds()");
+
+  if (a_warnMissing && m_verbose > 0) {
+    for (const auto& lossyVar : m_plotLossyVars) {
+      if (
+        std::find(a_names.begin(), a_names.end(), lossyVar) == a_names.end()) {
+        Print() << " WARNING: lossy plot variable " << lossyVar
+                << " not found in the plot variables, skipping it\n";
+      }
+    }
+  }
+
+  for (int comp = 0; comp < a_names.size(); ++comp) {
+    const auto lossyIt =
+      std::find(m_plotLossyVars.begin(), m_plotLossyVars.end(), a_names[comp]);
+    const int ivar = static_cast<int>(lossyIt - m_plotLossyVars.begin());
+    const bool lossy = (lossyIt != m_plotLossyVars.end());
+
+    // Unit roundoff of the variable precision. Double precision data are
+    // written as is.
+    const std::string& precision = plotVarPrecision(a_names[comp]);
+    Real roundoff = 0.0;
+    if (precision == "single") {
+      roundoff = std::ldexp(1.0, -24);
+    } else if (precision == "half") {
+      roundoff = std::ldexp(1.0, -11);
+    }
+    if (!lossy && roundoff == 0.0) {
+      continue;
+    }
+
+    Real varMax = 0.0;
+    if (roundoff > 0.0 || (lossy && m_plotLossyRelErr[ivar] > 0.0)) {
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        varMax = std::max(varMax, a_mf[lev].norm0(comp, 0, true));
+      }
+      ParallelDescriptor::ReduceRealMax(varMax);
+    }
+
+    // Error bound: absolute, or relative to the variable max magnitude
+    Real errBound = 0.0;
+    if (lossy) {
+      errBound = m_plotLossyAbsErr[ivar];
+      if (m_plotLossyRelErr[ivar] > 0.0) {
+        Real relBound = m_plotLossyRelErr[ivar] * varMax;
+        errBound = (errBound > 0.0) ? std::min(errBound, relBound) : relBound;
+      }
+    }
+
+    // Rounding to a multiple of twice the bound guarantees |error| <= bound,
+    // then the mantissa is rounded to the variable precision: single
+    // precision in a double precision plotfile, or half precision (11
+    // significant bits, without the float16 exponent range limits). Single
+    // precision data in a single precision plotfile are rounded on write.
+    const Real step = 2.0 * std::max(errBound, 0.0);
+    const Real stepInv = (step > 0.0) ? 1.0 / step : 0.0;
+    const int roundMode =
+      (precision == "half")
+        ? 2
+        : ((precision == "single" && m_plotSinglePrecision == 0) ? 1 : 0);
+    if (step > 0.0 || roundMode > 0) {
+      for (int lev = 0; lev <= finest_level; ++lev) {
+        auto const& ma = a_mf[lev].arrays();
+        amrex::ParallelFor(
+          a_mf[lev],
+          [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+            Real val = ma[box_no](i, j, k, comp);
+            if (step > 0.0) {
+              val = step * std::round(val * stepInv);
+            }
+            if (roundMode == 1) {
+              val = static_cast<Real>(static_cast<float>(val));
+            } else if (roundMode == 2) {
+              int expo = 0;
+              const Real mant = std::frexp(val, &expo);
+              val = std::ldexp(std::round(mant * 2048.0) / 2048.0, expo);
+            }
+            ma[box_no](i, j, k, comp) = val;
+          });
+      }
+      Gpu::streamSynchronize();
+    }
+    steps[comp] = step;
+    // The quantized magnitude is at most varMax + step / 2
+    a_maxErr[comp] = 0.5 * step + roundoff * (varMax + 0.5 * step);
+  }
+
+  return steps;
+}
+
+const std::string&
+PeleLM::plotVarPrecision(const std::string& a_name) const
+{
+  for (int n = 0; n < m_plotPrecisionVars.size(); ++n) {
+    if (m_plotPrecisionVars[n] == a_name) {
+      return m_plotPrecisionTypes[n];
+    }
+  }
+  return m_plotPrecision;
+}
+
+void
+PeleLM::WritePlotPrecisionHeader(
+  const std::string& a_pltfile,
+  const Vector<std::string>& a_names,
+  const Vector<Real>& a_steps,
+  const Vector<Real>& a_maxErr) const
+{
+  if (!ParallelDescriptor::IOProcessor()) {
+    return;
+  }
+
+  std::string HeaderFileName(a_pltfile + "/PrecisionHeader");
+  std::ofstream HeaderFile;
+  HeaderFile.open(
+    HeaderFileName.c_str(), std::ofstream::out | std::ofstream::trunc);
+  if (!HeaderFile.good()) {
+    amrex::FileOpenFailed(HeaderFileName);
+  }
+
+  HeaderFile.precision(17);
+  HeaderFile << "PeleLMeX plotfile precision record\n";
+  HeaderFile << "precision "
+             << ((m_plotSinglePrecision != 0) ? "single" : "double") << "\n";
+  HeaderFile << "# variable precision quantization_step max_abs_error\n";
+  for (int n = 0; n < a_names.size(); ++n) {
+    HeaderFile << a_names[n] << " " << plotVarPrecision(a_names[n]) << " "
+               << a_steps[n] << " " << a_maxErr[n] << "\n";
+  }
+}
+
 void
 PeleLM::WriteHeader(const std::string& name, bool is_checkpoint) const
 {
@@ -534,35 +1109,116 @@ PeleLM::WriteCheckPointFile()
   WriteHeader(checkpointname, is_checkpoint);
   WriteJobInfo(checkpointname);
 
-  for (int lev = 0; lev <= finest_level; ++lev) {
-    VisMF::Write(
-      m_leveldata_new[lev]->state,
-      amrex::MultiFabFileFullPrefix(
-        lev, checkpointname, level_prefix, "state"));
+  // Save the load balancing costs, used to distribute the data on restart
+  if ((m_doLoadBalance != 0) && (m_loadBalanceCost != LoadBalanceCost::Ncell)) {
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      computeCosts(lev);
+      Vector<Real> costsVec(grids[lev].size());
+      ParallelDescriptor::GatherLayoutDataToVector(
+        *m_costs[lev], costsVec, ParallelDescriptor::IOProcessorNumber());
+      if (ParallelDescriptor::IOProcessor()) {
+        std::string CostsFileName(
+          checkpointname + "/" + level_prefix + std::to_string(lev) +
+          "/Costs");
+        std::ofstream CostsFile(CostsFileName);
+        if (!CostsFile.good()) {
+          amrex::FileOpenFailed(CostsFileName);
+        }
+        CostsFile.precision(17);
+        CostsFile << costsVec.size() << "\n";
+        for (const auto& cost : costsVec) {
+          CostsFile << cost << "\n";
+        }
+      }
+    }
+  }
 
-    VisMF::Write(
-      m_leveldata_new[lev]->gp, amrex::MultiFabFileFullPrefix(
-                                  lev, checkpointname, level_prefix, "gradp"));
+  // Statistics averaging time and variables
+  if ((m_do_stats != 0) && ParallelDescriptor::IOProcessor()) {
+    std::string StatsFileName(checkpointname + "/StatsHeader");
+    std::ofstream StatsFile(StatsFileName);
+    if (!StatsFile.good()) {
+      amrex::FileOpenFailed(StatsFileName);
+    }
+    StatsFile.precision(17);
+    StatsFile << m_statsTime << "\n";
+    StatsFile << m_statsPendingTime << "\n";
+    StatsFile << m_statsVars.size() << "\n";
+    for (const auto& var : m_statsVars) {
+      StatsFile << var << "\n";
+    }
+  }
 
-    VisMF::Write(
-      m_leveldata_new[lev]->press,
-      amrex::MultiFabFileFullPrefix(lev, checkpointname, level_prefix, "p"));
+  // Incremental checkpoints: hash the content of each FAB and only
+  // write an increment if the layout didn't change since the last one
+  Vector<std::unique_ptr<LayoutData<FabHash>>> newHash;
+  bool doIncrement = false;
+  if (m_check_base_int > 0) {
+    newHash.resize(finest_level + 1);
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      newHash[lev] =
+        std::make_unique<LayoutData<FabHash>>(grids[lev], dmap[lev]);
+      hashFabs(checkPointFields(lev), *newHash[lev]);
+    }
+    doIncrement = !m_chkBaseName.empty() &&
+                  (m_chkSinceBase + 1 < m_check_base_int) &&
+                  (m_chkHash.size() == finest_level + 1);
+    for (int lev = 0; lev <= finest_level && doIncrement; ++lev) {
+      doIncrement = m_chkHash[lev] &&
+                    m_chkHash[lev]->boxArray() == grids[lev] &&
+                    m_chkHash[lev]->DistributionMap() == dmap[lev];
+    }
+  }
 
-    if (m_incompressible == 0) {
-      if (m_has_divu != 0) {
-        VisMF::Write(
-          m_leveldata_new[lev]->divu,
-          amrex::MultiFabFileFullPrefix(
-            lev, checkpointname, level_prefix, "divU"));
+  if (doIncrement) {
+    WriteCheckPointIncrement(checkpointname, newHash);
+    m_chkChain.push_back(checkpointname);
+    ++m_chkSinceBase;
+
+    // Record the base and chain of increments to reconstruct the data,
+    // relative to this checkpoint such that the tree can be moved
+    if (ParallelDescriptor::IOProcessor()) {
+      std::ofstream IncrFile(checkpointname + "/IncrementInfo");
+      if (!IncrFile.good()) {
+        amrex::FileOpenFailed(checkpointname + "/IncrementInfo");
       }
-
-      if (m_do_react != 0) {
-        VisMF::Write(
-          m_leveldatareact[lev]->I_R,
-          amrex::MultiFabFileFullPrefix(
-            lev, checkpointname, level_prefix, "I_R"));
+      const std::filesystem::path chkDir =
+        std::filesystem::absolute(checkpointname).lexically_normal();
+      auto relativeToChk = [&chkDir](const std::string& a_path) {
+        return std::filesystem::absolute(a_path)
+          .lexically_normal()
+          .lexically_relative(chkDir)
+          .generic_string();
+      };
+      IncrFile << relativeToChk(m_chkBaseName) << "\n";
+      IncrFile << m_chkChain.size() << "\n";
+      for (const auto& incr : m_chkChain) {
+        IncrFile << relativeToChk(incr) << "\n";
+      }
+    }
+  } else {
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      for (auto& [name, mf] : checkPointFields(lev)) {
+        const std::string mfName = amrex::MultiFabFileFullPrefix(
+          lev, checkpointname, level_prefix, name);
+        if (m_aggWriter) {
+          m_aggWriter->write(*mf, mfName);
+        } else {
+          VisMF::Write(*mf, mfName);
+        }
       }
     }
+    if (m_aggWriter) {
+      m_aggWriter->drain();
+    }
+    if (m_check_base_int > 0) {
+      m_chkBaseName = checkpointname;
+      m_chkChain.clear();
+      m_chkSinceBase = 0;
+    }
+  }
+  if (m_check_base_int > 0) {
+    m_chkHash = std::move(newHash);
   }
 #ifdef PELE_USE_SPRAY
   if (do_spray_particles) {
@@ -574,6 +1230,210 @@ PeleLM::WriteCheckPointFile()
 #endif
 }
 
+Vector<std::pair<std::string, MultiFab*>>
+PeleLM::checkPointFields(int lev)
+{
+  Vector<std::pair<std::string, MultiFab*>> fields;
+  fields.emplace_back("state", &m_leveldata_new[lev]->state);
+  fields.emplace_back("gradp", &m_leveldata_new[lev]->gp);
+  fields.emplace_back("p", &m_leveldata_new[lev]->press);
+  if (m_incompressible == 0) {
+    if (m_has_divu != 0) {
+      fields.emplace_back("divU", &m_leveldata_new[lev]->divu);
+    }
+    if (m_do_react != 0) {
+      fields.emplace_back("I_R", &m_leveldatareact[lev]->I_R);
+    }
+  }
+  if (m_do_stats != 0) {
+    fields.emplace_back("stats", m_stats[lev].get());
+  }
+  return fields;
+}
+
+void
+PeleLM::WriteCheckPointIncrement(
+  const std::string& a_chkfile,
+  const Vector<std::unique_ptr<LayoutData<FabHash>>>& a_newHash)
+{
+  BL_PROFILE("PeleLMeX::WriteCheckPointIncrement()");
+
+  Long nFabsTotal = 0;
+  Long nFabsChanged = 0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    // Flag the FABs whose content changed since the previous checkpoint
+    const int nFabs = static_cast<int>(grids[lev].size());
+    Vector<int> changed(nFabs, 0);
+    for (MFIter mfi(*a_newHash[lev]); mfi.isValid(); ++mfi) {
+      if ((*a_newHash[lev])[mfi] != (*m_chkHash[lev])[mfi]) {
+        changed[mfi.index()] = 1;
+      }
+    }
+    ParallelDescriptor::ReduceIntMax(changed.data(), nFabs);
+
+    BoxList bl;
+    Vector<int> pmap;
+    Vector<int> fabIdx;
+    for (int i = 0; i < nFabs; ++i) {
+      if (changed[i] != 0) {
+        bl.push_back(grids[lev][i]);
+        pmap.push_back(dmap[lev][i]);
+        fabIdx.push_back(i);
+      }
+    }
+    nFabsTotal += nFabs;
+    nFabsChanged += static_cast<Long>(fabIdx.size());
+
+    if (ParallelDescriptor::IOProcessor()) {
+      std::string FabsFileName(
+        a_chkfile + "/" + level_prefix + std::to_string(lev) + "/ChangedFabs");
+      std::ofstream FabsFile(FabsFileName);
+      if (!FabsFile.good()) {
+        amrex::FileOpenFailed(FabsFileName);
+      }
+      FabsFile << fabIdx.size() << "\n";
+      for (int idx : fabIdx) {
+        FabsFile << idx << "\n";
+      }
+    }
+
+    if (fabIdx.empty()) {
+      continue;
+    }
+
+    // Write the changed FABs, keeping them on their owner rank
+    BoxArray ba(std::move(bl));
+    DistributionMapping dm(pmap);
+    for (auto& [name, mf] : checkPointFields(lev)) {
+      MultiFab delta(
+        amrex::convert(ba, mf->ixType()), dm, mf->nComp(), mf->nGrowVect());
+      for (MFIter mfi(delta); mfi.isValid(); ++mfi) {
+        delta[mfi].copy<RunOn::Device>((*mf)[fabIdx[mfi.index()]]);
+      }
+      Gpu::streamSynchronize();
+      VisMF::Write(
+        delta,
+        amrex::MultiFabFileFullPrefix(lev, a_chkfile, level_prefix, name));
+    }
+  }
+
+  if (m_verbose != 0) {
+    amrex::Print() << " Incremental checkpoint: " << nFabsChanged << "/"
+                   << nFabsTotal << " FABs changed since " << m_chkBaseName
+                   << (m_chkChain.empty() ? "" : " + increments") << "\n";
+  }
+}
+
+Real
+PeleLM::ReadCheckPointIncrement(const std::string& a_chkfile)
+{
+  BL_PROFILE("PeleLMeX::ReadCheckPointIncrement()");
+
+  Real readBytes = 0.0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(
+      a_chkfile + "/" + level_prefix + std::to_string(lev) + "/ChangedFabs",
+      fileCharPtr);
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream is(fileCharPtrString, std::istringstream::in);
+
+    int nChanged = 0;
+    is >> nChanged;
+    if (nChanged == 0) {
+      continue;
+    }
+    BoxList bl;
+    Vector<int> pmap;
+    Vector<int> fabIdx(nChanged);
+    for (int n = 0; n < nChanged; ++n) {
+      is >> fabIdx[n];
+      bl.push_back(grids[lev][fabIdx[n]]);
+      pmap.push_back(dmap[lev][fabIdx[n]]);
+    }
+
+    // Read the changed FABs directly on the rank owning them
+    BoxArray ba(std::move(bl));
+    DistributionMapping dm(pmap);
+    for (auto& [name, mf] : checkPointFields(lev)) {
+      const std::string mfName =
+        amrex::MultiFabFileFullPrefix(lev, a_chkfile, level_prefix, name);
+      // Statistics are only restarted when the checkpoint ones match
+      const bool skipStats =
+        (name == "stats") && (m_statsTime <= 0.0) && (m_statsPendingTime <= 0.0);
+      if (skipStats || !amrex::FileExists(mfName + "_H")) {
+        continue;
+      }
+      MultiFab delta(
+        amrex::convert(ba, mf->ixType()), dm, mf->nComp(), mf->nGrowVect());
+      VisMF::Read(delta, mfName);
+      for (MFIter mfi(delta); mfi.isValid(); ++mfi) {
+        (*mf)[fabIdx[mfi.index()]].copy<RunOn::Device>(delta[mfi]);
+      }
+      Gpu::streamSynchronize();
+      for (int i = 0; i < delta.size(); ++i) {
+        readBytes += static_cast<Real>(delta.fabbox(i).numPts()) *
+                     static_cast<Real>(delta.nComp() * sizeof(Real));
+      }
+    }
+  }
+  return readBytes;
+}
+
+DistributionMapping
+PeleLM::restartDistributionMap(int lev, const BoxArray& a_ba)
+{
+  if (
+    (m_doLoadBalance == 0) ||
+    (m_loadBalanceMethod != LoadBalanceMethod::SFC &&
+     m_loadBalanceMethod != LoadBalanceMethod::Knapsack &&
+     m_loadBalanceMethod != LoadBalanceMethod::Hierarchical)) {
+    return DistributionMapping{a_ba, ParallelDescriptor::NProcs()};
+  }
+
+  // Costs: saved in the checkpoint if available, number of cells otherwise
+  Vector<Real> costsVec(a_ba.size());
+  for (int i = 0; i < a_ba.size(); ++i) {
+    costsVec[i] = static_cast<Real>(a_ba[i].numPts());
+  }
+  std::string CostsFileName(
+    m_restart_chkfile + "/" + level_prefix + std::to_string(lev) + "/Costs");
+  if (
+    (m_loadBalanceCost != LoadBalanceCost::Ncell) &&
+    amrex::FileExists(CostsFileName)) {
+    Vector<char> fileCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(CostsFileName, fileCharPtr);
+    std::string fileCharPtrString(fileCharPtr.dataPtr());
+    std::istringstream is(fileCharPtrString, std::istringstream::in);
+    int nCosts = 0;
+    is >> nCosts;
+    if (nCosts == a_ba.size()) {
+      for (auto& cost : costsVec) {
+        is >> cost;
+      }
+    }
+  }
+
+  Real efficiency = 0.0;
+  DistributionMapping dm;
+  if (m_loadBalanceMethod == LoadBalanceMethod::SFC) {
+    dm = DistributionMapping::makeSFC(costsVec, a_ba, efficiency);
+  } else if (m_loadBalanceMethod == LoadBalanceMethod::Hierarchical) {
+    dm = hierarchicalDistributionMap(lev, costsVec, a_ba, efficiency);
+  } else {
+    const amrex::Real navg = static_cast<Real>(a_ba.size()) /
+                             static_cast<Real>(ParallelDescriptor::NProcs());
+    const int nmax = static_cast<int>(
+      std::max(std::round(m_loadBalanceKSfactor * navg), std::ceil(navg)));
+    dm = DistributionMapping::makeKnapSack(costsVec, efficiency, nmax);
+  }
+  if (m_verbose > 1) {
+    Print() << " Restart distribution of level " << lev
+            << ", efficiency: " << efficiency << "\n";
+  }
+  return dm;
+}
+
 void
 PeleLM::ReadCheckPointFile()
 {
@@ -680,8 +1540,8 @@ PeleLM::ReadCheckPointFile()
     ba.readFrom(is);
     GotoNextLine(is);
 
-    // Create distribution mapping
-    DistributionMapping dm{ba, ParallelDescriptor::NProcs()};
+    // Create the target distribution mapping, data are read directly on it
+    DistributionMapping dm = restartDistributionMap(lev, ba);
     MakeNewLevelFromScratch(lev, m_cur_time, ba, dm);
   }
 
@@ -704,6 +1564,49 @@ PeleLM::ReadCheckPointFile()
    * Load fluid data                                                         *
    ***************************************************************************/
 
+  // Bound the number of concurrent readers per file
+  const int nReadersDefault = VisMF::GetMFFileInStreams();
+  if (m_restart_nreaders > 0) {
+    VisMF::SetMFFileInStreams(m_restart_nreaders);
+  }
+  Real readStart = ParallelDescriptor::second();
+
+  // Incremental checkpoint: load the base data then apply the increments
+  std::string dataChkFile = m_restart_chkfile;
+  Vector<std::string> incrChain;
+  if (amrex::FileExists(m_restart_chkfile + "/IncrementInfo")) {
+    Vector<char> incrCharPtr;
+    ParallelDescriptor::ReadAndBcastFile(
+      m_restart_chkfile + "/IncrementInfo", incrCharPtr);
+    std::string incrCharPtrString(incrCharPtr.dataPtr());
+    std::istringstream iis(incrCharPtrString, std::istringstream::in);
+    // Paths are relative to the restart checkpoint
+    auto resolveFromChk = [this](const std::string& a_path) {
+      std::filesystem::path path =
+        (std::filesystem::path(m_restart_chkfile) / a_path).lexically_normal();
+      if (!path.has_filename()) {
+        path = path.parent_path();
+      }
+      return path.string();
+    };
+    int nIncr = 0;
+    iis >> dataChkFile >> nIncr;
+    dataChkFile = resolveFromChk(dataChkFile);
+    incrChain.resize(nIncr);
+    for (auto& incr : incrChain) {
+      iis >> incr;
+      incr = resolveFromChk(incr);
+    }
+#ifdef PELE_USE_EFIELD
+    if (m_restart_nonEF) {
+      amrex::Abort("Restarting a non-EF run is not available from an "
+                   "incremental checkpoint");
+    }
+#endif
+    amrex::Print() << " Reconstructing data from base checkpoint "
+                   << dataChkFile << " and " << nIncr << " increment(s)\n";
+  }
+
   // Load the field data
   for (int lev = 0; lev <= finest_level; ++lev) {
 #ifdef PELE_USE_EFIELD
@@ -711,13 +1614,13 @@ PeleLM::ReadCheckPointFile()
       VisMF::Read(
         m_leveldata_new[lev]->state,
         amrex::MultiFabFileFullPrefix(
-          lev, m_restart_chkfile, level_prefix, "state"));
+          lev, dataChkFile, level_prefix, "state"));
     } else {
       // The chk state is 2 component shorter since phiV and nE aren't in it
       MultiFab stateTemp(grids[lev], dmap[lev], NVAR - 2, m_nGrowState);
       VisMF::Read(
         stateTemp, amrex::MultiFabFileFullPrefix(
-                     lev, m_restart_chkfile, level_prefix, "state"));
+                     lev, dataChkFile, level_prefix, "state"));
       MultiFab::Copy(
         m_leveldata_new[lev]->state, stateTemp, 0, 0, NVAR - 2, m_nGrowState);
     }
@@ -725,24 +1628,24 @@ PeleLM::ReadCheckPointFile()
     VisMF::Read(
       m_leveldata_new[lev]->state,
       amrex::MultiFabFileFullPrefix(
-        lev, m_restart_chkfile, level_prefix, "state"));
+        lev, dataChkFile, level_prefix, "state"));
 #endif
 
     VisMF::Read(
       m_leveldata_new[lev]->gp,
       amrex::MultiFabFileFullPrefix(
-        lev, m_restart_chkfile, level_prefix, "gradp"));
+        lev, dataChkFile, level_prefix, "gradp"));
 
     VisMF::Read(
       m_leveldata_new[lev]->press,
-      amrex::MultiFabFileFullPrefix(lev, m_restart_chkfile, level_prefix, "p"));
+      amrex::MultiFabFileFullPrefix(lev, dataChkFile, level_prefix, "p"));
 
     if (m_incompressible == 0) {
       if (m_has_divu != 0) {
         VisMF::Read(
           m_leveldata_new[lev]->divu,
           amrex::MultiFabFileFullPrefix(
-            lev, m_restart_chkfile, level_prefix, "divU"));
+            lev, dataChkFile, level_prefix, "divU"));
       }
 
 #ifdef PELE_USE_EFIELD
@@ -751,7 +1654,7 @@ PeleLM::ReadCheckPointFile()
           VisMF::Read(
             m_leveldatareact[lev]->I_R,
             amrex::MultiFabFileFullPrefix(
-              lev, m_restart_chkfile, level_prefix, "I_R"));
+              lev, dataChkFile, level_prefix, "I_R"));
         }
       } else {
         // I_R for non-EF simulation is one component shorted, need to account
@@ -760,7 +1663,7 @@ PeleLM::ReadCheckPointFile()
           MultiFab I_Rtemp(grids[lev], dmap[lev], NUM_SPECIES, 0);
           VisMF::Read(
             I_Rtemp, amrex::MultiFabFileFullPrefix(
-                       lev, m_restart_chkfile, level_prefix, "I_R"));
+                       lev, dataChkFile, level_prefix, "I_R"));
           MultiFab::Copy(
             m_leveldatareact[lev]->I_R, I_Rtemp, 0, 0, NUM_SPECIES, 0);
         }
@@ -773,11 +1676,79 @@ PeleLM::ReadCheckPointFile()
         VisMF::Read(
           m_leveldatareact[lev]->I_R,
           amrex::MultiFabFileFullPrefix(
-            lev, m_restart_chkfile, level_prefix, "I_R"));
+            lev, dataChkFile, level_prefix, "I_R"));
       }
 #endif
     }
   }
+
+  // Statistics: resume the accumulation if the checkpoint has matching ones
+  if (m_do_stats != 0) {
+    bool statsRestart = false;
+    if (amrex::FileExists(m_restart_chkfile + "/StatsHeader")) {
+      Vector<char> statsCharPtr;
+      ParallelDescriptor::ReadAndBcastFile(
+        m_restart_chkfile + "/StatsHeader", statsCharPtr);
+      std::string statsCharPtrString(statsCharPtr.dataPtr());
+      std::istringstream sis(statsCharPtrString, std::istringstream::in);
+      Real statsTime = 0.0;
+      Real statsPendingTime = 0.0;
+      int nStatsVars = 0;
+      sis >> statsTime >> statsPendingTime >> nStatsVars;
+      Vector<std::string> statsVars(nStatsVars);
+      for (auto& var : statsVars) {
+        sis >> var;
+      }
+      if (statsVars == m_statsVars) {
+        statsRestart = true;
+        m_statsTime = statsTime;
+        m_statsPendingTime = statsPendingTime;
+        for (int lev = 0; lev <= finest_level; ++lev) {
+          VisMF::Read(
+            *m_stats[lev], amrex::MultiFabFileFullPrefix(
+                             lev, dataChkFile, level_prefix, "stats"));
+        }
+      }
+    }
+    if (!statsRestart) {
+      amrex::Print() << " WARNING: no matching statistics in the checkpoint,"
+                     << " starting the statistics accumulation from scratch\n";
+      m_statsTime = 0.0;
+      m_statsPendingTime = 0.0;
+    }
+  }
+
+  Real incrBytes = 0.0;
+  for (const auto& incr : incrChain) {
+    incrBytes += ReadCheckPointIncrement(incr);
+  }
+  VisMF::SetMFFileInStreams(nReadersDefault);
+
+  // Report the read bandwidth, base data and increments
+  if (m_verbose != 0) {
+    Real readTime = ParallelDescriptor::second() - readStart;
+    ParallelDescriptor::ReduceRealMax(readTime);
+    Real readBytes = incrBytes;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      for (auto& [name, mf] : checkPointFields(lev)) {
+        const bool skipStats = (name == "stats") && (m_statsTime <= 0.0) &&
+                               (m_statsPendingTime <= 0.0);
+        if (skipStats) {
+          continue;
+        }
+        for (int i = 0; i < mf->size(); ++i) {
+          readBytes += static_cast<Real>(mf->fabbox(i).numPts()) *
+                       static_cast<Real>(mf->nComp() * sizeof(Real));
+        }
+      }
+    }
+    amrex::Print() << " Read " << readBytes / 1.0e9 << " GB of data in "
+                   << readTime << " s";
+    if (readTime > 0.0) {
+      amrex::Print() << " (" << readBytes / 1.0e9 / readTime << " GB/s)";
+    }
+    amrex::Print() << "\n";
+  }
   if (m_verbose != 0) {
     amrex::Print() << "Restart complete" << std::endl;
   }
@@ -799,8 +1770,20 @@ PeleLM::initLevelDataFromPlt(int a_lev, const std::string& a_dataPltFile)
     amrex::Print() << " Assuming pltfile was generated in PeleC \n";
   }
 
-  // Use PelePhysics PltFileManager
-  pele::physics::pltfilemanager::PltFileManager pltData(a_dataPltFile);
+  // Use PelePhysics PltFileManager, reading the pltfile once for all levels
+  if (!m_initPltData) {
+    Real readStart = ParallelDescriptor::second();
+    m_initPltData =
+      std::make_unique<pele::physics::pltfilemanager::PltFileManager>(
+        a_dataPltFile);
+    Real readTime = ParallelDescriptor::second() - readStart;
+    ParallelDescriptor::ReduceRealMax(readTime);
+    if (m_verbose > 0) {
+      amrex::Print() << " Read pltfile " << a_dataPltFile << " in " << readTime
+                     << " s\n";
+    }
+  }
+  auto& pltData = *m_initPltData;
   Vector<std::string> plt_vars = pltData.getVariableList();
   if (m_do_reset_time == 0) {
     m_cur_time = pltData.getTime();
@@ -950,9 +1933,51 @@ PeleLM::initLevelDataFromPlt(int a_lev, const std::string& a_dataPltFile)
     }
   }
 #endif
-  // Pressure and pressure gradients to zero
+  // Fast init: reuse the pressure gradient, divU and reaction rates of the
+  // pltfile, only if they are copied (not interpolated) on this level and
+  // the flow variables are not patched
+  bool reuseLevel = false;
+  int igp = -1, idivu = -1, iIR = -1;
+  if (
+    (m_initPltFast != 0) && (pltfileSource == "LM") &&
+    !m_do_patch_flow_variables) {
+    for (int i = 0; i < plt_vars.size(); ++i) {
+      if (plt_vars[i] == "gradpx") {
+        igp = i;
+      } else if (plt_vars[i] == "divu") {
+        idivu = i;
+      } else if (plt_vars[i] == "I_R(" + spec_names[0] + ")") {
+        iIR = i;
+      }
+    }
+    // Same level index space: same domain and refinement ratios
+    amrex::PlotFileData pltHeader(a_dataPltFile);
+    bool sameLevelData = (a_lev <= pltHeader.finestLevel()) &&
+                         (pltHeader.probDomain(a_lev) == geom[a_lev].Domain());
+    for (int lev = 0; lev < a_lev && sameLevelData; ++lev) {
+      sameLevelData = (refRatio(lev) == IntVect(pltHeader.refRatio(lev)));
+    }
+    sameLevelData =
+      sameLevelData && pltHeader.boxArray(a_lev).contains(grids[a_lev]);
+    const bool hasIR =
+      (m_do_react == 0) || (iIR >= 0 && iIR + nCompIR() <= plt_vars.size());
+    const bool hasDivu = (m_has_divu == 0) || (idivu >= 0);
+    reuseLevel = sameLevelData && (igp >= 0) && hasIR && hasDivu;
+  }
+
+  // Pressure to zero, pressure gradients from pltfile or zero
   ldata_p->press.setVal(0.0);
-  ldata_p->gp.setVal(0.0);
+  if (reuseLevel) {
+    pltData.fillPatchFromPlt(
+      a_lev, geom[a_lev], igp, 0, AMREX_SPACEDIM, ldata_p->gp);
+    if (m_do_react != 0) {
+      pltData.fillPatchFromPlt(
+        a_lev, geom[a_lev], iIR, 0, nCompIR(), m_leveldatareact[a_lev]->I_R);
+    }
+  } else {
+    ldata_p->gp.setVal(0.0);
+    m_initPltReuse = 0;
+  }
 
   ProbParm const* lprobparm = prob_parm_d;
 
@@ -1011,7 +2036,11 @@ PeleLM::initLevelDataFromPlt(int a_lev, const std::string& a_dataPltFile)
   // Initialize thermodynamic pressure
   setThermoPress(a_lev, AmrNewTime);
   if (m_has_divu != 0) {
-    ldata_p->divu.setVal(0.0);
+    if (reuseLevel) {
+      pltData.fillPatchFromPlt(a_lev, geom[a_lev], idivu, 0, 1, ldata_p->divu);
+    } else {
+      ldata_p->divu.setVal(0.0);
+    }
   }
 }
 
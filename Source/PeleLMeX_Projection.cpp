@@ -283,11 +283,17 @@ PeleLM::velocityProjection(
   Real SbarOld = 0.0;
   Real SbarNew = 0.0;
   if ((m_closed_chamber != 0) && (m_incompressible == 0)) {
-    SbarNew = MFSum(GetVecOfConstPtrs(getDivUVect(AmrNewTime)), 0);
-    SbarNew /= m_uncoveredVol; // Transform in Mean.
     if (incremental != 0) {
-      SbarOld = MFSum(GetVecOfConstPtrs(getDivUVect(AmrOldTime)), 0);
-      SbarOld /= m_uncoveredVol; // Transform in Mean.
+      // Get both in a single reduction
+      auto Sbars = MFSum(
+        {GetVecOfConstPtrs(getDivUVect(AmrNewTime)),
+         GetVecOfConstPtrs(getDivUVect(AmrOldTime))},
+        {0, 0});
+      SbarNew = Sbars[0] / m_uncoveredVol; // Transform in Mean.
+      SbarOld = Sbars[1] / m_uncoveredVol; // Transform in Mean.
+    } else {
+      SbarNew = MFSum(GetVecOfConstPtrs(getDivUVect(AmrNewTime)), 0);
+      SbarNew /= m_uncoveredVol; // Transform in Mean.
     }
   }
 
@@ -439,6 +445,8 @@ PeleLM::doNodalProject(
 
   // Solve
   nodal_projector->project(m_nodal_mg_rtol, m_nodal_mg_atol);
+  m_perfTrace.addSolverIters(
+    PerfTrace::NodalSolve, nodal_projector->getMLMG().getNumIters());
 
   auto phi = nodal_projector->getPhi();
   auto gphi = nodal_projector->getGradPhi();
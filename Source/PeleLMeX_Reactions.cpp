@@ -11,9 +11,19 @@ PeleLM::advanceChemistry(std::unique_ptr<AdvanceAdvData>& advData)
 {
   BL_PROFILE("PeleLMeX::advanceChemistry()");
 
+#if defined(AMREX_USE_OMP) && !defined(PELE_USE_EFIELD)
+  if ((m_chemOmpTasks != 0) && Gpu::notInLaunchRegion()) {
+    advanceChemistryTasks(advData);
+    return;
+  }
+#endif
+
   for (int lev = finest_level; lev >= 0; --lev) {
     if (lev != finest_level) {
       advanceChemistryBAChem(lev, m_dt, advData->Forcing[lev]);
+      // Fine-covered boxes were skipped by the integrator: fill them with
+      // the averaged fine level results
+      averageDownChemistry(lev + 1);
     } else {
       // If we defined a new BA for chem on finest level, use that instead of
       // the default one
@@ -26,6 +36,44 @@ PeleLM::advanceChemistry(std::unique_ptr<AdvanceAdvData>& advData)
   }
 }
 
+// Average the chemistry results (new rhoYs, rhoH, T and I_R) of a_fineLev
+// onto the next coarser level, overwriting the fine-covered cells that were
+// not integrated
+void
+PeleLM::averageDownChemistry(int a_fineLev)
+{
+  BL_PROFILE("PeleLMeX::averageDownChemistry()");
+  AMREX_ASSERT(a_fineLev > 0);
+
+  auto* ldataFine_p = getLevelDataPtr(a_fineLev, AmrNewTime);
+  auto* ldataCrse_p = getLevelDataPtr(a_fineLev - 1, AmrNewTime);
+  auto* ldataRFine_p = getLevelDataReactPtr(a_fineLev);
+  auto* ldataRCrse_p = getLevelDataReactPtr(a_fineLev - 1);
+#ifdef AMREX_USE_EB
+  EB_average_down(
+    ldataFine_p->state, ldataCrse_p->state, FIRSTSPEC, NUM_SPECIES + 2,
+    refRatio(a_fineLev - 1));
+  EB_average_down(
+    ldataRFine_p->I_R, ldataRCrse_p->I_R, 0, nCompIR(),
+    refRatio(a_fineLev - 1));
+#ifdef PELE_USE_EFIELD
+  EB_average_down(
+    ldataFine_p->state, ldataCrse_p->state, NE, 1, refRatio(a_fineLev - 1));
+#endif
+#else
+  average_down(
+    ldataFine_p->state, ldataCrse_p->state, FIRSTSPEC, NUM_SPECIES + 2,
+    refRatio(a_fineLev - 1));
+  average_down(
+    ldataRFine_p->I_R, ldataRCrse_p->I_R, 0, nCompIR(),
+    refRatio(a_fineLev - 1));
+#ifdef PELE_USE_EFIELD
+  average_down(
+    ldataFine_p->state, ldataCrse_p->state, NE, 1, refRatio(a_fineLev - 1));
+#endif
+#endif
+}
+
 // This advanceChemistry is called on the finest level
 // It works with the AmrCore BoxArray and do not involve ParallelCopy
 void
@@ -45,6 +93,7 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
   mask.setVal(1);
 #endif
 
+  const Real chemStart = ParallelDescriptor::second();
   MFItInfo mfi_info;
   if (Gpu::notInLaunchRegion()) {
     mfi_info.EnableTiling().SetDynamic(true);
@@ -137,6 +186,12 @@ PeleLM::advanceChemistry(int lev, const Real& a_dt, MultiFab& a_extForcing)
     Gpu::Device::streamSynchronize();
 #endif
   }
+  if (m_perfTrace.isActive()) {
+    // Integration time and function calls of this rank
+    m_perfTrace.addChemistry(
+      lev, ParallelDescriptor::second() - chemStart,
+      ldataR_p->functC.sum(0, true));
+  }
 
   // Set reaction term
 #ifdef AMREX_USE_OMP
@@ -210,6 +265,7 @@ PeleLM::advanceChemistryBAChem(
   chemnE.ParallelCopy(ldataOld_p->state, NE, 0, 1);
 #endif
 
+  const Real chemStart = ParallelDescriptor::second();
   MFItInfo mfi_info;
   if (Gpu::notInLaunchRegion()) {
     mfi_info.EnableTiling().SetDynamic(true);
@@ -227,6 +283,18 @@ PeleLM::advanceChemistryBAChem(
     auto const& fcl = functC.array(mfi);
     auto const& mask_arr = mask.array(mfi);
 
+    // Do reaction only on uncovered box, fine-covered boxes are later
+    // filled by averaging down the fine level results
+    int do_reactionBox = m_baChemFlag[lev][mfi.index()];
+
+    if (do_reactionBox == 0) {
+      // Just set the function call to 0.0
+      ParallelFor(bx, [fcl] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+        fcl(i, j, k) = 0.0;
+      });
+      continue;
+    }
+
     // Convert MKS -> CGS
     ParallelFor(
       bx, [rhoY_o, rhoH_o, extF_rhoY,
@@ -256,28 +324,18 @@ PeleLM::advanceChemistryBAChem(
       });
 #endif
 
-    // Do reaction only on uncovered box
-    int do_reactionBox = m_baChemFlag[lev][mfi.index()];
-
-    if (do_reactionBox != 0) {
-      // Do reaction as usual using PelePhysics chemistry integrator
-      Real dt_incr = a_dt;
-      Real time_chem = 0;
-      /* Solve */
-      m_reactor->react(
-        bx, rhoY_o, extF_rhoY, temp_o, rhoH_o, extF_rhoH, fcl, mask_arr,
-        dt_incr, time_chem
+    // Do reaction as usual using PelePhysics chemistry integrator
+    Real dt_incr = a_dt;
+    Real time_chem = 0;
+    /* Solve */
+    m_reactor->react(
+      bx, rhoY_o, extF_rhoY, temp_o, rhoH_o, extF_rhoH, fcl, mask_arr, dt_incr,
+      time_chem
 #ifdef AMREX_USE_GPU
-        ,
-        amrex::Gpu::gpuStream()
+      ,
+      amrex::Gpu::gpuStream()
 #endif
-      );
-    } else {
-      // Just set the function call to 0.0
-      ParallelFor(bx, [fcl] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
-        fcl(i, j, k) = 0.0;
-      });
-    }
+    );
 
     // Convert CGS -> MKS
     ParallelFor(
@@ -304,6 +362,12 @@ PeleLM::advanceChemistryBAChem(
     Gpu::Device::streamSynchronize();
 #endif
   }
+  if (m_perfTrace.isActive()) {
+    // Integration time and function calls of this rank, on the chemistry
+    // distribution map
+    m_perfTrace.addChemistry(
+      lev, ParallelDescriptor::second() - chemStart, functC.sum(0, true));
+  }
 
   // ParallelCopy into newstate MFs
   // Get the entire new state
@@ -366,6 +430,212 @@ PeleLM::advanceChemistryBAChem(
   }
 }
 
+#if defined(AMREX_USE_OMP) && !defined(PELE_USE_EFIELD)
+// This advanceChemistry gathers the uncovered chemistry boxes of all the
+// levels in a single pool of OpenMP tasks, such that small coarse levels do
+// not leave most of the threads idle while the finest level is integrated.
+void
+PeleLM::advanceChemistryTasks(std::unique_ptr<AdvanceAdvData>& advData)
+{
+  BL_PROFILE("PeleLMeX::advanceChemistryTasks()");
+
+  // Set chemistry MFs based on baChem and dmapChem on all levels
+  // and ParallelCopy into them
+  Vector<MultiFab> chemState(finest_level + 1);
+  Vector<MultiFab> chemForcing(finest_level + 1);
+  Vector<MultiFab> functC(finest_level + 1);
+  Vector<iMultiFab> mask(finest_level + 1);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto* ldataOld_p = getLevelDataPtr(lev, AmrOldTime);
+    chemState[lev].define(
+      *m_baChem[lev], *m_dmapChem[lev], NUM_SPECIES + 3, 0);
+    chemForcing[lev].define(
+      *m_baChem[lev], *m_dmapChem[lev], nCompForcing(), 0);
+    functC[lev].define(*m_baChem[lev], *m_dmapChem[lev], 1, 0);
+    mask[lev].define(*m_baChem[lev], *m_dmapChem[lev], 1, 0);
+#ifdef AMREX_USE_EB
+    getCoveredIMask(lev, mask[lev]);
+#else
+    mask[lev].setVal(1);
+#endif
+    chemState[lev].ParallelCopy(
+      ldataOld_p->state, FIRSTSPEC, 0, NUM_SPECIES + 3);
+    chemForcing[lev].ParallelCopy(advData->Forcing[lev], 0, 0, nCompForcing());
+    functC[lev].setVal(0.0);
+  }
+
+  // Assemble the list of (level, box) tasks, only for boxes requiring
+  // integration, larger boxes first to limit the tail
+  Vector<std::pair<int, int>> tasks;
+  for (int lev = finest_level; lev >= 0; --lev) {
+    for (int idx : chemState[lev].IndexArray()) {
+      if (m_baChemFlag[lev][idx] != 0) {
+        tasks.emplace_back(lev, idx);
+      }
+    }
+  }
+  std::stable_sort(
+    tasks.begin(), tasks.end(),
+    [&chemState](
+      const std::pair<int, int>& a, const std::pair<int, int>& b) {
+      return chemState[a.first].box(a.second).numPts() >
+             chemState[b.first].box(b.second).numPts();
+    });
+
+  // Per-thread busy time to evaluate the parallel efficiency, and per
+  // thread and level for the performance trace
+  const int maxThreads = OpenMP::get_max_threads();
+  Vector<Real> threadBusy(maxThreads, 0.0);
+  Vector<Real> threadLevBusy(
+    static_cast<Long>(maxThreads) * (finest_level + 1), 0.0);
+  int nThreads = 1;
+
+  Real taskStart = ParallelDescriptor::second();
+#pragma omp parallel
+#pragma omp single
+  {
+    nThreads = OpenMP::get_num_threads();
+    for (const auto& task : tasks) {
+#pragma omp task firstprivate(task)
+      {
+        Real boxStart = ParallelDescriptor::second();
+        const int lev = task.first;
+        const int idx = task.second;
+        const Box& bx = chemState[lev].box(idx);
+        auto const& rhoY_o = chemState[lev].array(idx, 0);
+        auto const& rhoH_o = chemState[lev].array(idx, NUM_SPECIES);
+        auto const& temp_o = chemState[lev].array(idx, NUM_SPECIES + 1);
+        auto const& extF_rhoY = chemForcing[lev].array(idx, 0);
+        auto const& extF_rhoH = chemForcing[lev].array(idx, NUM_SPECIES);
+        auto const& fcl = functC[lev].array(idx);
+        auto const& mask_arr = mask[lev].array(idx);
+
+        // Convert MKS -> CGS
+        ParallelFor(
+          bx, [rhoY_o, rhoH_o, extF_rhoY,
+               extF_rhoH] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            for (int n = 0; n < NUM_SPECIES; n++) {
+              rhoY_o(i, j, k, n) *= 1.0e-3;
+              extF_rhoY(i, j, k, n) *= 1.0e-3;
+            }
+            rhoH_o(i, j, k) *= 10.0;
+            extF_rhoH(i, j, k) *= 10.0;
+          });
+
+        Real dt_incr = m_dt;
+        Real time_chem = 0;
+        /* Solve */
+        m_reactor->react(
+          bx, rhoY_o, extF_rhoY, temp_o, rhoH_o, extF_rhoH, fcl, mask_arr,
+          dt_incr, time_chem);
+
+        // Convert CGS -> MKS
+        ParallelFor(
+          bx, [rhoY_o, rhoH_o] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+            for (int n = 0; n < NUM_SPECIES; n++) {
+              rhoY_o(i, j, k, n) *= 1.0e3;
+            }
+            rhoH_o(i, j, k) *= 0.1;
+          });
+        const Real boxTime = ParallelDescriptor::second() - boxStart;
+        const int tid = OpenMP::get_thread_num();
+        threadBusy[tid] += boxTime;
+        threadLevBusy[static_cast<Long>(tid) * (finest_level + 1) + lev] +=
+          boxTime;
+      }
+    }
+  }
+  Real taskTime = ParallelDescriptor::second() - taskStart;
+
+  // Share of the task pool time spent on each level and function calls of
+  // this rank, on the chemistry distribution maps
+  if (m_perfTrace.isActive()) {
+    Real busyTime = 0.0;
+    for (const auto& t : threadBusy) {
+      busyTime += t;
+    }
+    const Long nLevs = finest_level + 1;
+    for (int lev = 0; lev <= finest_level; ++lev) {
+      Real levBusy = 0.0;
+      for (int t = 0; t < maxThreads; ++t) {
+        levBusy += threadLevBusy[t * nLevs + lev];
+      }
+      const Real levTime =
+        (busyTime > 0.0) ? taskTime * levBusy / busyTime : 0.0;
+      m_perfTrace.addChemistry(lev, levTime, functC[lev].sum(0, true));
+    }
+  }
+
+  // ParallelCopy back into the level data and set reaction term,
+  // from fine to coarse to fill the fine-covered cells
+  for (int lev = finest_level; lev >= 0; --lev) {
+    auto* ldataOld_p = getLevelDataPtr(lev, AmrOldTime);
+    auto* ldataNew_p = getLevelDataPtr(lev, AmrNewTime);
+    auto* ldataR_p = getLevelDataReactPtr(lev);
+
+    MultiFab StateTemp(grids[lev], dmap[lev], NUM_SPECIES + 3, 0);
+    StateTemp.ParallelCopy(chemState[lev], 0, 0, NUM_SPECIES + 3);
+    ldataR_p->functC.ParallelCopy(functC[lev], 0, 0, 1);
+
+    auto const& extForcing = advData->Forcing[lev];
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+    for (MFIter mfi(ldataNew_p->state, TilingIfNotGPU()); mfi.isValid();
+         ++mfi) {
+      const Box& bx = mfi.tilebox();
+      auto const& state_arr = StateTemp.const_array(mfi);
+      auto const& rhoY_o = ldataOld_p->state.const_array(mfi, FIRSTSPEC);
+      auto const& rhoY_n = ldataNew_p->state.array(mfi, FIRSTSPEC);
+      auto const& rhoH_n = ldataNew_p->state.array(mfi, RHOH);
+      auto const& temp_n = ldataNew_p->state.array(mfi, TEMP);
+      auto const& extF_rhoY = extForcing.const_array(mfi, 0);
+      auto const& rhoYdot = ldataR_p->I_R.array(mfi, 0);
+      Real dt_inv = 1.0 / m_dt;
+      ParallelFor(
+        bx, [state_arr, rhoY_o, rhoY_n, rhoH_n, temp_n, extF_rhoY, rhoYdot,
+             dt_inv] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            rhoY_n(i, j, k, n) = state_arr(i, j, k, n);
+          }
+          rhoH_n(i, j, k) = state_arr(i, j, k, NUM_SPECIES);
+          temp_n(i, j, k) = state_arr(i, j, k, NUM_SPECIES + 1);
+          for (int n = 0; n < NUM_SPECIES; n++) {
+            rhoYdot(i, j, k, n) =
+              -(rhoY_o(i, j, k, n) - rhoY_n(i, j, k, n)) * dt_inv -
+              extF_rhoY(i, j, k, n);
+          }
+        });
+    }
+
+    if (lev != finest_level) {
+      averageDownChemistry(lev + 1);
+    }
+  }
+
+  // Parallel efficiency of the task pool: busy thread time / available time
+  if (m_verbose > 1) {
+    Real busyTime = 0.0;
+    for (const auto& t : threadBusy) {
+      busyTime += t;
+    }
+    Real efficiency =
+      (taskTime > 0.0) ? busyTime / (taskTime * static_cast<Real>(nThreads))
+                       : 1.0;
+    Real maxTaskTime = taskTime;
+    auto nTasks = static_cast<Long>(tasks.size());
+    ParallelDescriptor::ReduceRealMin(
+      efficiency, ParallelDescriptor::IOProcessorNumber());
+    ParallelDescriptor::ReduceRealMax(
+      maxTaskTime, ParallelDescriptor::IOProcessorNumber());
+    ParallelDescriptor::ReduceLongSum(
+      nTasks, ParallelDescriptor::IOProcessorNumber());
+    amrex::Print() << "   - advanceChemistryTasks()     --> " << nTasks
+                   << " tasks on " << nThreads
+                   << " threads, Time: " << maxTaskTime
+                   << ", min. thread efficiency: " << efficiency << "\n";
+  }
+}
+#endif
+
 void
 PeleLM::computeInstantaneousReactionRate(
   const Vector<MultiFab*>& I_R, const TimeStamp& a_time)
@@ -1,4 +1,5 @@
 #include <PeleLMeX.H>
+#include <algorithm>
 #include <memory>
 
 using namespace amrex;
@@ -12,6 +13,11 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
     return;
   }
 
+  // Levels up to lbase are unchanged, and so are the covered masks below
+  m_resetCoveredMaskLev = (m_resetCoveredMask != 0)
+                            ? std::min(m_resetCoveredMaskLev, lbase)
+                            : lbase;
+
   if (!m_regrid_file.empty()) {
     regridFromGridFile(lbase, time, initial);
 
@@ -50,6 +56,10 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
         test_dmap = DistributionMapping::makeKnapSack(
           *m_costs[0], currentEfficiency, testEfficiency, nmax, false,
           ParallelDescriptor::IOProcessorNumber());
+      } else if (m_loadBalanceMethod == LoadBalanceMethod::Hierarchical) {
+
+        test_dmap = hierarchicalDistributionMap(
+          0, *m_costs[0], currentEfficiency, testEfficiency);
       }
 
       // IO proc determine if the test dmap offers significant improvements
@@ -61,6 +71,11 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
           (remakeLevel != 0) ||
           (testEfficiency >
            m_loadBalanceEffRatioThreshold * currentEfficiency));
+        // and whether it is worth moving the data
+        if ((remakeLevel != 0) && (m_loadBalanceAmortize != 0)) {
+          remakeLevel = static_cast<int>(
+            remapPaysOff(0, test_dmap, currentEfficiency, testEfficiency));
+        }
       }
       ParallelDescriptor::Bcast(
         &remakeLevel, 1, ParallelDescriptor::IOProcessorNumber());
@@ -102,7 +117,10 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
 
     int new_finest;
     Vector<BoxArray> new_grids(finest_level + 2);
+    // Only actual regrids count toward the derefinement of inert regions
+    m_derefineUpdate = !initial;
     MakeNewGrids(lbase, time, new_finest, new_grids);
+    m_derefineUpdate = false;
 
     BL_ASSERT(new_finest <= finest_level + 1);
 
@@ -178,6 +196,19 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
               Real efficiency;
               new_dmap =
                 DistributionMapping::makeKnapSack(costsVec, efficiency, nmax);
+
+            } else if (
+              m_loadBalanceMethod == LoadBalanceMethod::Hierarchical) {
+
+              Vector<Real> costsVec(new_ba.size());
+              ParallelDescriptor::GatherLayoutDataToVector(
+                new_cost, costsVec, ParallelContext::IOProcessorNumberSub());
+              ParallelDescriptor::Bcast(
+                costsVec.data(), costsVec.size(),
+                ParallelContext::IOProcessorNumberSub());
+              Real efficiency;
+              new_dmap =
+                hierarchicalDistributionMap(lev, costsVec, new_ba, efficiency);
             }
 
             // Let's see if we can get a better dmap
@@ -214,6 +245,12 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
               test_dmap = DistributionMapping::makeKnapSack(
                 *m_costs[lev], currentEfficiency, testEfficiency, nmax, false,
                 ParallelDescriptor::IOProcessorNumber());
+
+            } else if (
+              m_loadBalanceMethod == LoadBalanceMethod::Hierarchical) {
+
+              test_dmap = hierarchicalDistributionMap(
+                lev, *m_costs[lev], currentEfficiency, testEfficiency);
             }
 
             // IO proc determine if the test dmap offers significant
@@ -226,6 +263,11 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
                 (remakeLevel != 0) ||
                 (testEfficiency >
                  m_loadBalanceEffRatioThreshold * currentEfficiency));
+              // and whether it is worth moving the data
+              if ((remakeLevel != 0) && (m_loadBalanceAmortize != 0)) {
+                remakeLevel = static_cast<int>(remapPaysOff(
+                  lev, test_dmap, currentEfficiency, testEfficiency));
+              }
             }
             ParallelDescriptor::Bcast(
               &remakeLevel, 1, ParallelDescriptor::IOProcessorNumber());
@@ -301,6 +343,127 @@ PeleLM::regrid(int lbase, amrex::Real time, bool initial)
   }
 }
 
+DistributionMapping
+PeleLM::hierarchicalDistributionMap(
+  int a_lev,
+  const Vector<Real>& a_cost,
+  const BoxArray& a_ba,
+  Real& a_efficiency)
+{
+  BL_PROFILE("PeleLMeX::hierarchicalDistributionMap()");
+
+  const auto& rankNodes = NodeLoadBalance::rankNodes(m_loadBalanceNodeSize);
+  DistributionMapping dm =
+    NodeLoadBalance::makeDistributionMap(a_cost, a_ba, rankNodes);
+  a_efficiency = NodeLoadBalance::efficiency(a_cost, dm);
+
+  if (m_verbose > 1) {
+    Long halo = 0;
+    Long interNodeHalo = 0;
+    NodeLoadBalance::haloVolume(
+      a_ba, dm, m_nGrowState, rankNodes, halo, interNodeHalo);
+    Print() << " Hierarchical distribution on level " << a_lev
+            << ": efficiency " << a_efficiency << ", inter-node halo "
+            << interNodeHalo << " of " << halo << " cells\n";
+  }
+  return dm;
+}
+
+DistributionMapping
+PeleLM::hierarchicalDistributionMap(
+  int a_lev,
+  const LayoutData<Real>& a_cost,
+  Real& a_currentEfficiency,
+  Real& a_efficiency)
+{
+  // Gather the costs on all the ranks, the map is then built locally
+  const BoxArray& ba = a_cost.boxArray();
+  Vector<Real> costsVec(ba.size());
+  ParallelDescriptor::GatherLayoutDataToVector(
+    a_cost, costsVec, ParallelContext::IOProcessorNumberSub());
+  ParallelDescriptor::Bcast(
+    costsVec.data(), costsVec.size(), ParallelContext::IOProcessorNumberSub());
+  a_currentEfficiency =
+    NodeLoadBalance::efficiency(costsVec, a_cost.DistributionMap());
+  return hierarchicalDistributionMap(a_lev, costsVec, ba, a_efficiency);
+}
+
+bool
+PeleLM::remapPaysOff(
+  int a_lev,
+  const DistributionMapping& a_newDM,
+  Real a_currentEfficiency,
+  Real a_testEfficiency)
+{
+  if (m_avgStepTime <= 0.0 || a_testEfficiency <= 0.0) {
+    return true;
+  }
+
+  // Number of Real per cell migrated with the level: old and new state
+  // data, transport, reaction and statistics data, and EB geometric data
+  int ncomp = 0;
+  for (const auto* ldata_p :
+       {m_leveldata_old[a_lev].get(), m_leveldata_new[a_lev].get()}) {
+    ncomp += ldata_p->state.nComp() + ldata_p->auxiliaries.nComp() +
+             ldata_p->gp.nComp() + ldata_p->divu.nComp() +
+             ldata_p->press.nComp() + ldata_p->visc_cc.nComp() +
+             ldata_p->diff_cc.nComp();
+  }
+  if (m_do_react != 0) {
+    ncomp += m_leveldatareact[a_lev]->I_R.nComp() +
+             m_leveldatareact[a_lev]->functC.nComp();
+  }
+  if (m_do_stats != 0) {
+    ncomp += m_stats[a_lev]->nComp();
+  }
+#ifdef AMREX_USE_EB
+  // Volume fraction, centroids, normals, area fractions, face centroids
+  ncomp += 2 + 3 * AMREX_SPACEDIM + AMREX_SPACEDIM * AMREX_SPACEDIM;
+#endif
+  const Real bytesPerCell = static_cast<Real>(ncomp * sizeof(Real));
+
+  // Bytes sent and received by each rank, the migration time being that of
+  // the busiest rank
+  const auto& oldPmap = dmap[a_lev].ProcessorMap();
+  const auto& newPmap = a_newDM.ProcessorMap();
+  Vector<Real> rankBytes(ParallelDescriptor::NProcs(), 0.0);
+  Real totalBytes = 0.0;
+  for (int i = 0; i < grids[a_lev].size(); ++i) {
+    if (oldPmap[i] != newPmap[i]) {
+      const Real bytes =
+        static_cast<Real>(grids[a_lev][i].numPts()) * bytesPerCell;
+      rankBytes[oldPmap[i]] += bytes;
+      rankBytes[newPmap[i]] += bytes;
+      totalBytes += bytes;
+    }
+  }
+  const Real migrationTime =
+    *std::max_element(rankBytes.begin(), rankBytes.end()) /
+    (m_loadBalanceBandwidth * 1.0e9);
+
+  // Time saved on the level until its next rebalance, the level share of
+  // the step time being estimated by its share of the cells
+  Long totalCells = 0;
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    totalCells += grids[lev].numPts();
+  }
+  const Real levelStepTime = m_avgStepTime *
+                             static_cast<Real>(grids[a_lev].numPts()) /
+                             static_cast<Real>(totalCells);
+  const int nSteps = regridInterval(std::max(a_lev - 1, 0));
+  const Real savedTime = static_cast<Real>(nSteps) * levelStepTime *
+                         (1.0 - a_currentEfficiency / a_testEfficiency);
+
+  const bool paysOff = savedTime > migrationTime;
+  if (m_verbose > 1) {
+    Print() << " Level " << a_lev << " remap: migrating "
+            << totalBytes / 1.0e6 << " MB in ~" << migrationTime
+            << " s, saving ~" << savedTime << " s over " << nSteps
+            << " steps, " << (paysOff ? "accepted" : "rejected") << "\n";
+  }
+  return paysOff;
+}
+
 void
 PeleLM::MakeNewLevelFromCoarse(
   int lev,
@@ -328,12 +491,8 @@ PeleLM::MakeNewLevelFromCoarse(
   }
 
   // New level factory
-#ifdef AMREX_USE_EB
   std::unique_ptr<FabFactory<FArrayBox>> new_fact =
-    makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
-#else
-  std::unique_ptr<FabFactory<FArrayBox>> new_fact(new FArrayBoxFactory());
-#endif
+    makeLevelFactory(lev, ba, dm);
 
   // New leveldatas
   std::unique_ptr<LevelData> n_leveldata_old(new LevelData(
@@ -368,6 +527,13 @@ PeleLM::MakeNewLevelFromCoarse(
     m_leveldatareact[lev] = std::move(n_leveldatareact);
   }
 
+  if (m_do_stats != 0) {
+    std::unique_ptr<MultiFab> n_stats = std::make_unique<MultiFab>(
+      ba, dm, 1 + 4 * static_cast<int>(m_statsVars.size()), 0);
+    fillcoarsepatch_stats(lev, time, *n_stats, 0);
+    m_stats[lev] = std::move(n_stats);
+  }
+
   if (m_incompressible == 0) {
     // Enforce density / species density consistency
     // only useful when using cell cons interp
@@ -421,6 +587,23 @@ PeleLM::RemakeLevel(
 {
   BL_PROFILE("PeleLMeX::RemakeLevel()");
 
+  // Level remade because a coarser level changed: its data and factory are
+  // still valid, only the operators spanning the hierarchy are rebuilt
+  if ((m_incrementalRegrid != 0) && ba == grids[lev] && dm == dmap[lev]) {
+    if (m_verbose > 0) {
+      Print() << " Keeping unchanged level " << lev << "\n";
+    }
+    m_resetCoveredMask = 1;
+#ifdef PELE_USE_EFIELD
+    m_precond_op.reset();
+#endif
+    m_diffusion_op.reset();
+    m_mcdiffusion_op.reset();
+    m_diffusionTensor_op.reset();
+    m_macProjNeedReset = 1;
+    return;
+  }
+
   if (m_verbose > 0) {
     Print() << " Remaking level " << lev << "\n";
     if (m_verbose > 2) {
@@ -439,12 +622,8 @@ PeleLM::RemakeLevel(
   }
 
   // New level factory
-#ifdef AMREX_USE_EB
   std::unique_ptr<FabFactory<FArrayBox>> new_fact =
-    makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
-#else
-  std::unique_ptr<FabFactory<FArrayBox>> new_fact(new FArrayBoxFactory());
-#endif
+    makeLevelFactory(lev, ba, dm);
 
   // New leveldatas
   std::unique_ptr<LevelData> n_leveldata_old(new LevelData(
@@ -455,14 +634,32 @@ PeleLM::RemakeLevel(
     ba, dm, *new_fact, m_incompressible, m_has_divu, m_nAux, m_nGrowState,
     m_use_soret, static_cast<int>(m_do_les)));
 
+  // Boxes unchanged from the current grids: their data is copied, only the
+  // other boxes are fill-patched
+  Vector<int> oldIdx(ba.size(), -1);
+  if (m_incrementalRegrid != 0) {
+    oldIdx = regridReuseMap(lev, ba);
+    if (m_verbose > 1) {
+      const auto nReused = std::count_if(
+        oldIdx.begin(), oldIdx.end(), [](int a_idx) { return a_idx >= 0; });
+      Print() << "   reusing " << nReused << " of " << ba.size() << " boxes\n";
+    }
+  }
+
   // Fill the leveldata_new
-  fillpatch_state(lev, time, n_leveldata_new->state, m_nGrowState);
-  fillpatch_gradp(lev, time, n_leveldata_new->gp, 0);
+  fillRegridIncremental(
+    oldIdx, n_leveldata_new->state, m_leveldata_new[lev]->state,
+    [&](MultiFab& a_mf) { fillpatch_state(lev, time, a_mf, m_nGrowState); });
+  fillRegridIncremental(
+    oldIdx, n_leveldata_new->gp, m_leveldata_new[lev]->gp,
+    [&](MultiFab& a_mf) { fillpatch_gradp(lev, time, a_mf, 0); });
   n_leveldata_new->press.setVal(0.0);
 
   if (m_incompressible == 0) {
     if (m_has_divu != 0) {
-      fillpatch_divu(lev, time, n_leveldata_new->divu, 1);
+      fillRegridIncremental(
+        oldIdx, n_leveldata_new->divu, m_leveldata_new[lev]->divu,
+        [&](MultiFab& a_mf) { fillpatch_divu(lev, time, a_mf, 1); });
     }
   }
 
@@ -474,11 +671,22 @@ PeleLM::RemakeLevel(
   if (m_do_react != 0) {
     std::unique_ptr<LevelDataReact> n_leveldatareact(
       new LevelDataReact(ba, dm, *m_factory[lev]));
-    fillpatch_reaction(lev, time, n_leveldatareact->I_R, 0);
+    fillRegridIncremental(
+      oldIdx, n_leveldatareact->I_R, m_leveldatareact[lev]->I_R,
+      [&](MultiFab& a_mf) { fillpatch_reaction(lev, time, a_mf, 0); });
     n_leveldatareact->functC.setVal(0.0);
     m_leveldatareact[lev] = std::move(n_leveldatareact);
   }
 
+  if (m_do_stats != 0) {
+    std::unique_ptr<MultiFab> n_stats = std::make_unique<MultiFab>(
+      ba, dm, 1 + 4 * static_cast<int>(m_statsVars.size()), 0);
+    fillRegridIncremental(
+      oldIdx, *n_stats, *m_stats[lev],
+      [&](MultiFab& a_mf) { fillpatch_stats(lev, time, a_mf, 0); });
+    m_stats[lev] = std::move(n_stats);
+  }
+
   if (max_level > 0 && lev != max_level) {
     m_coveredMask[lev] = std::make_unique<iMultiFab>(ba, dm, 1, 0);
   }
@@ -523,6 +731,158 @@ PeleLM::RemakeLevel(
   m_extSource[lev]->setVal(0.);
 }
 
+std::unique_ptr<FabFactory<FArrayBox>>
+PeleLM::makeLevelFactory(
+  int lev, const BoxArray& ba, const DistributionMapping& dm)
+{
+#ifdef AMREX_USE_EB
+  if (m_EBFactoryCacheMB <= 0.0) {
+    return makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
+  }
+
+  BL_PROFILE("PeleLMeX::makeLevelFactory()");
+
+  // Cached factory for the same level grids and distribution: the EB data
+  // collection is shared with the clone
+  for (auto it = m_EBFactoryCache.begin(); it != m_EBFactoryCache.end();
+       ++it) {
+    if (it->lev == lev && it->ba == ba && it->dm == dm) {
+      m_EBFactoryCache.splice(m_EBFactoryCache.begin(), m_EBFactoryCache, it);
+      if (m_verbose > 1) {
+        Print() << "   reusing cached EB factory on level " << lev << "\n";
+      }
+      return std::unique_ptr<FabFactory<FArrayBox>>(
+        m_EBFactoryCache.front().factory->clone());
+    }
+  }
+
+  std::unique_ptr<FabFactory<FArrayBox>> new_fact =
+    makeEBFabFactory(geom[lev], ba, dm, {6, 6, 6}, EBSupport::full);
+
+  // Estimate the average memory footprint per rank, identical on all the
+  // ranks such that cache hits are collective: flags, volfrac, bndryarea,
+  // centroid, bndrycent, bndrynorm, areafrac, edgecent and facecent
+  constexpr int nRealPerCell =
+    2 + 4 * AMREX_SPACEDIM + AMREX_SPACEDIM * AMREX_SPACEDIM;
+  Long ncells = 0;
+  for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+    ncells += amrex::grow(ba[i], 6).numPts();
+  }
+  const Real bytes =
+    static_cast<Real>(ncells) *
+    static_cast<Real>(sizeof(EBCellFlag) + nRealPerCell * sizeof(Real)) /
+    static_cast<Real>(ParallelDescriptor::NProcs());
+
+  // Insert, then evict the least recently used factories beyond the budget
+  const Real budget = m_EBFactoryCacheMB * 1024.0 * 1024.0;
+  if (bytes <= budget) {
+    m_EBFactoryCache.push_front(
+      {lev, ba, dm,
+       std::unique_ptr<FabFactory<FArrayBox>>(new_fact->clone()), bytes});
+    Real total = 0.0;
+    auto it = m_EBFactoryCache.begin();
+    for (; it != m_EBFactoryCache.end(); ++it) {
+      total += it->bytes;
+      if (total > budget) {
+        break;
+      }
+    }
+    m_EBFactoryCache.erase(it, m_EBFactoryCache.end());
+  }
+  return new_fact;
+#else
+  amrex::ignore_unused(lev, ba, dm);
+  return std::make_unique<FArrayBoxFactory>();
+#endif
+}
+
+Vector<int>
+PeleLM::regridReuseMap(int lev, const BoxArray& ba) const
+{
+  Vector<int> oldIdx(ba.size(), -1);
+  const BoxArray& oldBA = grids[lev];
+  if (oldBA.empty() || ba.ixType() != oldBA.ixType()) {
+    return oldIdx;
+  }
+
+  for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+    const Box bx = ba[i];
+    for (const auto& isect : oldBA.intersections(bx)) {
+      const int j = isect.first;
+      if (oldBA[j] == bx) {
+        oldIdx[i] = j;
+        break;
+      }
+    }
+  }
+  return oldIdx;
+}
+
+void
+PeleLM::fillRegridIncremental(
+  const Vector<int>& a_oldIdx,
+  MultiFab& a_mf,
+  const MultiFab& a_oldMf,
+  const std::function<void(MultiFab&)>& a_fill)
+{
+  BL_PROFILE("PeleLMeX::fillRegridIncremental()");
+
+  const BoxArray& ba = a_mf.boxArray();
+  const DistributionMapping& dm = a_mf.DistributionMap();
+
+  // Gather the new and unchanged boxes, same on all the ranks
+  Vector<int> newIdx;
+  BoxList newBoxes(ba.ixType());
+  Vector<int> newProcs;
+  Vector<int> reuseIdx;
+  BoxList reuseBoxes(ba.ixType());
+  Vector<int> reuseProcs;
+  for (int i = 0; i < static_cast<int>(ba.size()); ++i) {
+    if (a_oldIdx[i] < 0) {
+      newIdx.push_back(i);
+      newBoxes.push_back(ba[i]);
+      newProcs.push_back(dm[i]);
+    } else {
+      reuseIdx.push_back(i);
+      reuseBoxes.push_back(ba[i]);
+      reuseProcs.push_back(dm[i]);
+    }
+  }
+
+  // Nothing to reuse
+  if (reuseIdx.empty()) {
+    a_fill(a_mf);
+    return;
+  }
+
+  const int ncomp = a_mf.nComp();
+
+  // Fill-patch the new boxes only, then move them in place
+  if (!newIdx.empty()) {
+    const BoxArray patchBA(std::move(newBoxes));
+    const DistributionMapping patchDM(std::move(newProcs));
+    MultiFab patch(patchBA, patchDM, ncomp, a_mf.nGrowVect());
+    a_fill(patch);
+    for (MFIter mfi(patch); mfi.isValid(); ++mfi) {
+      a_mf[newIdx[mfi.index()]].copy<RunOn::Device>(patch[mfi], 0, 0, ncomp);
+    }
+  }
+
+  // Copy the valid cells of the unchanged boxes from their current owner.
+  // Their ghost cells, which may border new boxes, are left to the next
+  // fill-patch of the level data.
+  const BoxArray reuseBA(std::move(reuseBoxes));
+  const DistributionMapping reuseDM(std::move(reuseProcs));
+  MultiFab reuse(reuseBA, reuseDM, ncomp, 0);
+  reuse.ParallelCopy(a_oldMf, 0, 0, ncomp);
+  for (MFIter mfi(reuse); mfi.isValid(); ++mfi) {
+    const Box& bx = mfi.validbox();
+    a_mf[reuseIdx[mfi.index()]].copy<RunOn::Device>(
+      reuse[mfi], bx, 0, bx, 0, ncomp);
+  }
+  Gpu::streamSynchronize();
+}
+
 void
 PeleLM::ClearLevel(int lev)
 {
@@ -536,6 +896,17 @@ PeleLM::ClearLevel(int lev)
   if (max_level > 0 && lev != max_level) {
     m_coveredMask[lev].reset();
   }
+  m_volWgt[lev].reset();
+  // The next coarser level is no longer covered: its volume weights and
+  // chemistry BoxArray need to be rebuilt
+  if (lev > 0) {
+    m_volWgt[lev - 1].reset();
+    m_resetCoveredMask = 1;
+    m_resetCoveredMaskLev = std::min(m_resetCoveredMaskLev, lev - 1);
+  }
+  if (m_do_stats != 0) {
+    m_stats[lev].reset();
+  }
   m_baChem[lev].reset();
   m_dmapChem[lev].reset();
   m_factory[lev].reset();
@@ -0,0 +1,153 @@
+#include "PeleLMeX_Sampler.H"
+
+#include <AMReX.H>
+#include <AMReX_ParmParse.H>
+#include <AMReX_Utility.H>
+
+#include <cstdint>
+#include <cstring>
+
+Sampler::Sampler(const std::string& a_name, int a_writerRank)
+  : m_name(a_name), m_writerRank(a_writerRank)
+{
+  amrex::ParmParse pp("peleLM." + m_name);
+
+  std::string type;
+  pp.get("type", type);
+  pp.get("int", m_interval);
+  pp.getarr("field_names", m_fieldNames);
+  std::string precision{"single"};
+  pp.query("precision", precision);
+  m_singlePrecision = static_cast<int>(precision == "single");
+
+  auto getRealVect = [&pp](const std::string& a_key) {
+    amrex::Vector<amrex::Real> vec(AMREX_SPACEDIM);
+    pp.getarr(a_key.c_str(), vec, 0, AMREX_SPACEDIM);
+    return amrex::RealVect(vec);
+  };
+
+  if (type == "plane") {
+    // Oblique plane spanned by two (non-normalized) axis from an origin
+    amrex::RealVect origin = getRealVect("origin");
+    amrex::RealVect axis1 = getRealVect("axis1");
+    amrex::RealVect axis2 = getRealVect("axis2");
+    amrex::Vector<int> npts(2);
+    pp.getarr("npts", npts, 0, 2);
+    m_points.reserve(static_cast<amrex::Long>(npts[0]) * npts[1]);
+    for (int j = 0; j < npts[1]; ++j) {
+      for (int i = 0; i < npts[0]; ++i) {
+        m_points.push_back(
+          origin + ((i + 0.5) / npts[0]) * axis1 +
+          ((j + 0.5) / npts[1]) * axis2);
+      }
+    }
+  } else if (type == "line") {
+    amrex::RealVect start = getRealVect("start");
+    amrex::RealVect end = getRealVect("end");
+    int npts = 0;
+    pp.get("npts", npts);
+    m_points.reserve(npts);
+    for (int i = 0; i < npts; ++i) {
+      m_points.push_back(start + ((i + 0.5) / npts) * (end - start));
+    }
+  } else if (type == "probes") {
+    amrex::Vector<amrex::Real> coords;
+    pp.getarr("points", coords);
+    if (coords.size() % AMREX_SPACEDIM != 0) {
+      amrex::Abort(
+        "peleLM." + m_name + ".points must contain " +
+        std::to_string(AMREX_SPACEDIM) + " coordinates per probe");
+    }
+    for (int p = 0; p < coords.size() / AMREX_SPACEDIM; ++p) {
+      m_points.emplace_back(
+        AMREX_D_DECL(
+          coords[AMREX_SPACEDIM * p], coords[AMREX_SPACEDIM * p + 1],
+          coords[AMREX_SPACEDIM * p + 2]));
+    }
+  } else {
+    amrex::Abort(
+      "Unknown sampler type " + type + " for peleLM." + m_name +
+      ", must be plane, line or probes");
+  }
+}
+
+void
+Sampler::openFile()
+{
+  const std::string fileName = "samples/" + m_name + ".bin";
+  const auto spacedim = static_cast<std::int32_t>(AMREX_SPACEDIM);
+  const auto npts = static_cast<std::int32_t>(m_points.size());
+  const auto nvars = static_cast<std::int32_t>(m_fieldNames.size());
+  const std::int32_t nbytes = (m_singlePrecision != 0) ? 4 : 8;
+
+  // Appending to an existing file (restart): check the layout is the same
+  bool writeHeader = true;
+  {
+    std::ifstream existing(fileName.c_str(), std::ios::in | std::ios::binary);
+    if (
+      existing.good() &&
+      existing.peek() != std::ifstream::traits_type::eof()) {
+      char fileMagic[8];
+      std::int32_t fileHead[4] = {0, 0, 0, 0};
+      existing.read(fileMagic, 8);
+      existing.read(reinterpret_cast<char*>(fileHead), sizeof(fileHead));
+      if (
+        std::strncmp(fileMagic, magic, 8) != 0 || fileHead[0] != spacedim ||
+        fileHead[1] != npts || fileHead[2] != nvars || fileHead[3] != nbytes) {
+        amrex::Abort(
+          "Existing samples file " + fileName +
+          " does not match the sampler definition");
+      }
+      writeHeader = false;
+    }
+  }
+
+  m_file.open(
+    fileName.c_str(), std::ios::out | std::ios::app | std::ios_base::binary);
+  if (!m_file.good()) {
+    amrex::FileOpenFailed(fileName);
+  }
+  if (writeHeader) {
+    m_file.write(magic, 8);
+    for (std::int32_t val : {spacedim, npts, nvars, nbytes}) {
+      m_file.write(reinterpret_cast<const char*>(&val), sizeof(val));
+    }
+    for (const auto& name : m_fieldNames) {
+      const auto len = static_cast<std::int32_t>(name.size());
+      m_file.write(reinterpret_cast<const char*>(&len), sizeof(len));
+      m_file.write(name.data(), len);
+    }
+    for (const auto& pt : m_points) {
+      for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+        const auto coord = static_cast<double>(pt[idim]);
+        m_file.write(reinterpret_cast<const char*>(&coord), sizeof(coord));
+      }
+    }
+  }
+}
+
+void
+Sampler::write(
+  int a_nstep, amrex::Real a_time, const amrex::Vector<amrex::Real>& a_values)
+{
+  if (!m_file.is_open()) {
+    openFile();
+  }
+
+  const auto step = static_cast<std::int64_t>(a_nstep);
+  const auto time = static_cast<double>(a_time);
+  m_file.write(reinterpret_cast<const char*>(&step), sizeof(step));
+  m_file.write(reinterpret_cast<const char*>(&time), sizeof(time));
+  if (m_singlePrecision != 0) {
+    amrex::Vector<float> values(a_values.begin(), a_values.end());
+    m_file.write(
+      reinterpret_cast<const char*>(values.data()),
+      static_cast<std::streamsize>(values.size() * sizeof(float)));
+  } else {
+    amrex::Vector<double> values(a_values.begin(), a_values.end());
+    m_file.write(
+      reinterpret_cast<const char*>(values.data()),
+      static_cast<std::streamsize>(values.size() * sizeof(double)));
+  }
+  m_file.flush();
+}
@@ -15,6 +15,9 @@
 #ifdef PELE_USE_SOOT
 #include "SootModel.H"
 #endif
+
+#include <algorithm>
+
 using namespace amrex;
 
 static Box
@@ -94,6 +97,7 @@ PeleLM::Setup()
 #endif
   // Diagnostics setup
   createDiagnostics();
+  createSamplers();
 
   // Boundary Patch Setup
   if (m_do_patch_mfr != 0) {
@@ -420,11 +424,23 @@ PeleLM::readParameters()
   pp.query("num_init_iter", m_init_iter);
   pp.query("initDataPlt_patch_flow_variables", m_do_patch_flow_variables);
   pp.query("initDataPlt_reset_time", m_do_reset_time);
+  pp.query("initDataPlt_fast", m_initPltFast);
+  pp.query("initDataPlt_fast_init_iter", m_initPltFastIter);
+  pp.query("initDataPlt_fast_divu_tol", m_initPltFastDivuTol);
 
   // -----------------------------------------
   // advance
   // -----------------------------------------
   pp.query("sdc_iterMax", m_nSDCmax);
+  pp.query("sdc_adaptive", m_sdcAdaptive);
+  if (m_sdcAdaptive != 0) {
+    pp.query("sdc_iterMin", m_nSDCmin);
+    pp.query("sdc_tol", m_sdcTol);
+    pp.query("sdc_divu_tol", m_sdcDivuTol);
+    if (m_nSDCmin < 1 || m_nSDCmin > m_nSDCmax) {
+      amrex::Abort("peleLM.sdc_iterMin must be in [1, peleLM.sdc_iterMax]");
+    }
+  }
   pp.query("floor_species", m_floor_species);
   pp.query("dPdt_factor", m_dpdtFactor);
   pp.query("memory_checks", m_checkMem);
@@ -465,14 +481,48 @@ PeleLM::readParameters()
     }
   }
 
+  // Run the pointwise transport and EOS kernels on compact boxes when faster
+  pp.query("compute_layout", m_do_computeLayout);
+  if (m_do_computeLayout != 0) {
+    IntVect computeBoxSize(AMREX_D_DECL(32, 32, 32));
+    const int cbs_size = pp.countval("compute_box_size");
+    if (cbs_size == 1) {
+      int cbs;
+      pp.get("compute_box_size", cbs);
+      computeBoxSize = IntVect(cbs);
+    } else if (cbs_size == AMREX_SPACEDIM) {
+      Vector<int> cbs;
+      pp.getarr("compute_box_size", cbs, 0, AMREX_SPACEDIM);
+      computeBoxSize = IntVect(cbs);
+    } else if (cbs_size != 0) {
+      Abort("peleLM.compute_box_size should have 1 or AMREX_SPACEDIM values");
+    }
+    m_computeLayout.define(max_level, computeBoxSize, m_verbose);
+  }
+
+  // Integrate the chemistry of all levels in a single pool of OpenMP tasks
+  pp.query("chem_omp_tasks", m_chemOmpTasks);
+#if !defined(AMREX_USE_OMP) || defined(AMREX_USE_GPU) ||                      \
+  defined(PELE_USE_EFIELD)
+  if (m_chemOmpTasks != 0) {
+    Print() << " WARNING: peleLM.chem_omp_tasks requires an OpenMP CPU build "
+               "without EFIELD, switching it off \n";
+    m_chemOmpTasks = 0;
+  }
+#endif
+
   // -----------------------------------------
   // Load Balancing
   // -----------------------------------------
   pp.query("do_load_balancing", m_doLoadBalance);
   parseUserKey(pp, "load_balancing_method", lbmethod, m_loadBalanceMethod);
+  pp.query("load_balancing_node_size", m_loadBalanceNodeSize);
   parseUserKey(pp, "load_balancing_cost_estimate", lbcost, m_loadBalanceCost);
   pp.query(
     "load_balancing_efficiency_threshold", m_loadBalanceEffRatioThreshold);
+  pp.query("load_balancing_amortize", m_loadBalanceAmortize);
+  pp.query("load_balancing_bandwidth", m_loadBalanceBandwidth); // GB/s
+  AMREX_ALWAYS_ASSERT(m_loadBalanceBandwidth > 0.0);
   parseUserKey(
     pp, "chem_load_balancing_method", lbmethod, m_loadBalanceMethodChem);
   parseUserKey(
@@ -550,6 +600,63 @@ PeleLM::readParameters()
     pp.query("do_mass_balance", m_do_massBalance);
     pp.query("do_species_balance", m_do_speciesBalance);
     pp.query("do_patch_mfr", m_do_patch_mfr);
+    std::string temporal_format{"ascii"};
+    pp.query("temporal_format", temporal_format);
+    if (temporal_format == "binary") {
+      m_temporalBinary = 1;
+      m_temporalBufferRows = 100;
+    } else if (temporal_format != "ascii") {
+      amrex::Abort("peleLM.temporal_format must be either 'ascii' or 'binary'");
+    }
+    pp.query("temporal_buffer_rows", m_temporalBufferRows);
+  }
+
+  // -----------------------------------------
+  // Performance trace
+  // -----------------------------------------
+  pp.query("perf_trace", m_do_perfTrace);
+  if (m_do_perfTrace != 0) {
+    pp.query("perf_trace_int", m_perfTraceInt);
+    std::string trace_format{"binary"};
+    pp.query("perf_trace_format", trace_format);
+    if (trace_format == "ascii") {
+      m_perfTraceBinary = 0;
+    } else if (trace_format == "binary") {
+      m_perfTraceBinary = 1;
+      m_perfTraceBufferRows = 100;
+    } else {
+      amrex::Abort(
+        "peleLM.perf_trace_format must be either 'ascii' or 'binary'");
+    }
+    pp.query("perf_trace_buffer_rows", m_perfTraceBufferRows);
+  }
+
+  // -----------------------------------------
+  // Statistics
+  // -----------------------------------------
+  pp.query("do_stats", m_do_stats);
+  if (m_do_stats != 0) {
+    pp.query("stats_int", m_stats_int);
+    pp.query("stats_start_time", m_stats_start_time);
+    pp.query("stats_species", m_stats_species);
+    AMREX_ALWAYS_ASSERT(m_stats_int > 0);
+    AMREX_D_TERM(m_statsVars.push_back("x_velocity");
+                 , m_statsVars.push_back("y_velocity");
+                 , m_statsVars.push_back("z_velocity"));
+    if (m_incompressible == 0) {
+      m_statsVars.push_back("temp");
+      if (m_do_react != 0) {
+        m_statsVars.push_back("HeatRelease");
+      }
+      if (m_stats_species != 0) {
+        Vector<std::string> spec_names;
+        pele::physics::eos::speciesNames<pele::physics::PhysicsType::eos_type>(
+          spec_names);
+        for (const auto& spec_name : spec_names) {
+          m_statsVars.push_back("Y(" + spec_name + ")");
+        }
+      }
+    }
   }
 
   // -----------------------------------------
@@ -573,6 +680,37 @@ PeleLM::readParameters()
   if (max_level > 0 || (m_doLoadBalance != 0)) {
     ppa.query("regrid_int", m_regrid_int);
     ppa.query("regrid_on_restart", m_regrid_on_restart);
+    if (max_level > 0 && m_regrid_int > 0) {
+      // Per-level regrid intervals, default to regrid_int. Missing entries
+      // take the value of the last one provided.
+      m_regridLevelInt.resize(max_level, m_regrid_int);
+      const int nLevInt =
+        std::min(ppa.countval("regrid_level_int"), max_level);
+      if (nLevInt > 0) {
+        ppa.getarr("regrid_level_int", m_regridLevelInt, 0, nLevInt);
+        m_regridLevelInt.resize(max_level, m_regridLevelInt[nLevInt - 1]);
+      }
+      for (const int levInt : m_regridLevelInt) {
+        if (levInt <= 0) {
+          Abort("amr.regrid_level_int entries must be > 0");
+        }
+      }
+    }
+    ppa.query("regrid_on_demand", m_regridOnDemand);
+    if (m_regridOnDemand != 0) {
+      if (m_regrid_int <= 0) {
+        Abort("amr.regrid_on_demand requires amr.regrid_int > 0");
+      }
+      m_regridMaxInt = 10 * m_regrid_int;
+      ppa.query("regrid_max_int", m_regridMaxInt);
+      ppa.query("regrid_drift_buffer", m_regridDriftBuffer);
+      ppa.query("regrid_drift_fraction", m_regridDriftFrac);
+      m_regridCheckInt = std::max(1, m_regrid_int / 2);
+      ppa.query("regrid_check_int", m_regridCheckInt);
+      AMREX_ALWAYS_ASSERT(m_regridCheckInt > 0);
+      AMREX_ALWAYS_ASSERT(m_regridMaxInt >= m_regrid_int);
+      AMREX_ALWAYS_ASSERT(m_regridDriftBuffer >= 0);
+    }
   }
 
 #ifdef AMREX_USE_EB
@@ -596,6 +734,7 @@ PeleLM::readParameters()
     }
   }
   pp.query("isothermal_EB", m_isothermalEB);
+  pp.query("EB_factory_cache_mb", m_EBFactoryCacheMB);
 #endif
 
   // -----------------------------------------
@@ -675,7 +814,9 @@ PeleLM::readIOParameters()
   pp.query("check_file", m_check_file);
   pp.query("check_int", m_check_int);
   pp.query("check_per", m_check_per);
+  pp.query("check_base_int", m_check_base_int);
   pp.query("restart", m_restart_chkfile);
+  pp.query("restart_nreaders", m_restart_nreaders);
   pp.query("initDataPlt", m_restart_pltfile);
   pp.query("initDataPltSource", pltfileSource);
   pp.query("plot_file", m_plot_file);
@@ -705,8 +846,83 @@ PeleLM::readIOParameters()
   pp.query("regrid_file", m_regrid_file);
   pp.query("file_stepDigits", m_ioDigits);
   pp.query("use_hdf5_plt", m_write_hdf5_pltfile);
+  auto validPrecision = [](const std::string& a_precision) {
+    return a_precision == "double" || a_precision == "single" ||
+           a_precision == "half";
+  };
+  pp.query("plot_precision", m_plotPrecision);
+  if (!validPrecision(m_plotPrecision)) {
+    amrex::Abort("amr.plot_precision must be 'double', 'single' or 'half'");
+  }
+  int nPrecisionVars = pp.countval("plot_precision_vars");
+  if (nPrecisionVars > 0) {
+    pp.getarr("plot_precision_vars", m_plotPrecisionVars);
+    pp.getarr("plot_precision_types", m_plotPrecisionTypes);
+    if (m_plotPrecisionTypes.size() != nPrecisionVars) {
+      amrex::Abort(
+        "amr.plot_precision_types must have one entry per "
+        "amr.plot_precision_vars");
+    }
+    for (const auto& precision : m_plotPrecisionTypes) {
+      if (!validPrecision(precision)) {
+        amrex::Abort(
+          "amr.plot_precision_types must be 'double', 'single' or 'half'");
+      }
+    }
+  }
+  // The data are stored in single precision unless a variable needs double
+  m_plotSinglePrecision = static_cast<int>(
+    m_plotPrecision != "double" &&
+    std::find(
+      m_plotPrecisionTypes.begin(), m_plotPrecisionTypes.end(), "double") ==
+      m_plotPrecisionTypes.end());
+  pp.query("plot_mem_budget", m_plotMemBudget);
+  int io_aggregate = 0;
+  pp.query("io_aggregate", io_aggregate);
+  if (io_aggregate != 0) {
+    std::string io_stage_dir;
+    int io_stage_async = 0;
+    pp.query("io_stage_dir", io_stage_dir);
+    pp.query("io_stage_async", io_stage_async);
+    m_aggWriter = std::make_unique<NodeAggregatedWriter>();
+    m_aggWriter->setStaging(io_stage_dir, io_stage_async != 0);
+  }
+  int nLossyVars = pp.countval("plot_lossy_vars");
+  if (nLossyVars > 0) {
+    pp.getarr("plot_lossy_vars", m_plotLossyVars);
+    m_plotLossyAbsErr.resize(nLossyVars, 0.0);
+    m_plotLossyRelErr.resize(nLossyVars, 0.0);
+    if (pp.contains("plot_lossy_abs_err")) {
+      pp.getarr("plot_lossy_abs_err", m_plotLossyAbsErr);
+    }
+    if (pp.contains("plot_lossy_rel_err")) {
+      pp.getarr("plot_lossy_rel_err", m_plotLossyRelErr);
+    }
+    if (
+      m_plotLossyAbsErr.size() != nLossyVars ||
+      m_plotLossyRelErr.size() != nLossyVars) {
+      amrex::Abort(
+        "amr.plot_lossy_abs_err/rel_err must have one entry per "
+        "amr.plot_lossy_vars");
+    }
+  }
+  // The HDF5 writer always stores full double precision data
+  if (
+    m_write_hdf5_pltfile &&
+    (m_plotPrecision != "double" ||
+     std::find_if(
+       m_plotPrecisionTypes.begin(), m_plotPrecisionTypes.end(),
+       [](const std::string& a_precision) {
+         return a_precision != "double";
+       }) != m_plotPrecisionTypes.end() ||
+     !m_plotLossyVars.empty())) {
+    amrex::Abort(
+      "amr.plot_precision, amr.plot_precision_vars and amr.plot_lossy_vars "
+      "are not supported with amr.use_hdf5_plt");
+  }
   pp.query("regrid_interp_method", m_regrid_interp_method);
   AMREX_ASSERT(m_regrid_interp_method == 0 || m_regrid_interp_method == 1);
+  pp.query("incremental_regrid", m_incrementalRegrid);
 }
 
 void
@@ -1294,6 +1510,52 @@ PeleLM::taggingSetup()
         refinement_indicator);
     }
   }
+
+  // Derefinement of inert regions
+  ParmParse ppderef(amr_prefix + ".derefine");
+  ppderef.query("temperature_difference", m_derefineTempDiff);
+  ppderef.query("heat_release", m_derefineHeatRelease);
+  ppderef.queryarr(
+    "species", m_derefineSpecies, 0, ppderef.countval("species"));
+  if (!m_derefineSpecies.empty()) {
+    ppderef.get("species_difference", m_derefineSpecDiff);
+  }
+  m_derefine = static_cast<int>(
+    m_derefineTempDiff > 0.0 || m_derefineHeatRelease > 0.0 ||
+    (!m_derefineSpecies.empty() && m_derefineSpecDiff > 0.0));
+  if (m_derefine != 0) {
+    m_derefineMaxLevel = max_level;
+    ppderef.query("max_level", m_derefineMaxLevel);
+    ppderef.query("n_regrids", m_derefineNRegrids);
+    ppderef.query("hysteresis", m_derefineHysteresis);
+    AMREX_ALWAYS_ASSERT(m_derefineNRegrids > 0);
+    AMREX_ALWAYS_ASSERT(m_derefineHysteresis >= 1.0);
+    if (
+      m_derefineHeatRelease > 0.0 &&
+      ((m_do_react == 0) || (m_incompressible != 0))) {
+      amrex::Error(
+        "PeleLM::taggingSetup(): amr.derefine.heat_release requires "
+        "reactions");
+    }
+    for (const auto& spec : m_derefineSpecies) {
+      if (!derive_lst.canDerive("Y(" + spec + ")")) {
+        amrex::Error(
+          "PeleLM::taggingSetup(): unknown species for derefinement " + spec);
+      }
+    }
+    if (max_level > 0) {
+      m_derefineCount.resize(max_level);
+    }
+  }
+
+  // Predictive tagging
+  ParmParse pp("peleLM");
+  pp.query("predictive_tagging", m_predictiveTagging);
+  if (m_predictiveTagging != 0) {
+    pp.query("predictive_tagging_flame_speed", m_predTagFlameSpeed);
+    pp.query("predictive_tagging_max_cells", m_predTagMaxCells);
+    AMREX_ALWAYS_ASSERT(m_predTagMaxCells >= 0);
+  }
 }
 
 void
@@ -1312,6 +1574,8 @@ PeleLM::resizeArray()
   if (max_level > 0) {
     m_coveredMask.resize(max_level);
   }
+  m_volWgt.resize(max_level + 1);
+  m_stats.resize(max_level + 1);
   m_baChem.resize(max_level + 1);
   m_dmapChem.resize(max_level + 1);
   m_baChemFlag.resize(max_level + 1);
@@ -0,0 +1,115 @@
+#include <PeleLMeX.H>
+
+using namespace amrex;
+
+void
+PeleLM::updateStatistics()
+{
+  if ((m_do_stats == 0) || (m_cur_time <= m_stats_start_time)) {
+    return;
+  }
+
+  // Time elapsed since the last sample, accounting for the start time
+  m_statsPendingTime += std::min(m_dt, m_cur_time - m_stats_start_time);
+  if (m_nstep % m_stats_int != 0) {
+    return;
+  }
+
+  BL_PROFILE("PeleLMeX::updateStatistics()");
+
+  const Real weight = m_statsPendingTime;
+  m_statsTime += weight;
+  m_statsPendingTime = 0.0;
+
+  const int nvars = static_cast<int>(m_statsVars.size());
+  const int is_incomp = m_incompressible;
+  const Real rho_incomp = m_rho;
+
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+
+    // Gather the sampled variables
+    MultiFab vars(grids[lev], dmap[lev], nvars, 0, MFInfo(), Factory(lev));
+    int cnt = 0;
+    MultiFab::Copy(vars, ldata_p->state, VELX, cnt, AMREX_SPACEDIM, 0);
+    cnt += AMREX_SPACEDIM;
+    if (m_incompressible == 0) {
+      MultiFab::Copy(vars, ldata_p->state, TEMP, cnt, 1, 0);
+      cnt += 1;
+      if (m_do_react != 0) {
+        MultiFab HR(grids[lev], dmap[lev], 1, 0);
+        getHeatRelease(lev, &HR);
+        MultiFab::Copy(vars, HR, 0, cnt, 1, 0);
+        cnt += 1;
+      }
+      if (m_stats_species != 0) {
+        auto const& var_arr = vars.arrays();
+        auto const& state_arr = ldata_p->state.const_arrays();
+        const int spec_comp = cnt;
+        amrex::ParallelFor(
+          vars, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+            const Real rho = state_arr[box_no](i, j, k, DENSITY);
+            const Real rhoinv = (rho > 0.0) ? 1.0 / rho : 0.0;
+            for (int n = 0; n < NUM_SPECIES; n++) {
+              var_arr[box_no](i, j, k, spec_comp + n) =
+                state_arr[box_no](i, j, k, FIRSTSPEC + n) * rhoinv;
+            }
+          });
+        cnt += NUM_SPECIES;
+      }
+    }
+    AMREX_ASSERT(cnt == nvars);
+
+    // Update the accumulators in place
+    auto const& stats_arr = m_stats[lev]->arrays();
+    auto const& var_arr = vars.const_arrays();
+    auto const& state_arr = ldata_p->state.const_arrays();
+    amrex::ParallelFor(
+      *m_stats[lev],
+      [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+        const Real rho = (is_incomp != 0)
+                           ? rho_incomp
+                           : state_arr[box_no](i, j, k, DENSITY);
+        auto s = stats_arr[box_no];
+        s(i, j, k, 0) += weight * rho;
+        for (int n = 0; n < nvars; n++) {
+          const Real q = var_arr[box_no](i, j, k, n);
+          s(i, j, k, 1 + 4 * n) += weight * q;
+          s(i, j, k, 2 + 4 * n) += weight * q * q;
+          s(i, j, k, 3 + 4 * n) += weight * rho * q;
+          s(i, j, k, 4 + 4 * n) += weight * rho * q * q;
+        }
+      });
+  }
+  Gpu::streamSynchronize();
+}
+
+void
+PeleLM::getStatistics(int lev, MultiFab& a_mf, int a_dcomp)
+{
+  BL_PROFILE("PeleLMeX::getStatistics()");
+
+  const int nvars = static_cast<int>(m_statsVars.size());
+  const Real timeinv = (m_statsTime > 0.0) ? 1.0 / m_statsTime : 0.0;
+
+  auto const& out_arr = a_mf.arrays();
+  auto const& stats_arr = m_stats[lev]->const_arrays();
+  amrex::ParallelFor(
+    a_mf, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+      auto const& s = stats_arr[box_no];
+      const Real rhoSum = s(i, j, k, 0);
+      const Real rhoSumInv = (rhoSum > 0.0) ? 1.0 / rhoSum : 0.0;
+      for (int n = 0; n < nvars; n++) {
+        const Real mean = s(i, j, k, 1 + 4 * n) * timeinv;
+        const Real var = s(i, j, k, 2 + 4 * n) * timeinv - mean * mean;
+        const Real fmean = s(i, j, k, 3 + 4 * n) * rhoSumInv;
+        const Real fvar = s(i, j, k, 4 + 4 * n) * rhoSumInv - fmean * fmean;
+        const int comp = a_dcomp + 4 * n;
+        out_arr[box_no](i, j, k, comp) = mean;
+        out_arr[box_no](i, j, k, comp + 1) = std::sqrt(amrex::max(0.0, var));
+        out_arr[box_no](i, j, k, comp + 2) = fmean;
+        out_arr[box_no](i, j, k, comp + 3) = std::sqrt(amrex::max(0.0, fvar));
+      }
+    });
+  Gpu::streamSynchronize();
+}
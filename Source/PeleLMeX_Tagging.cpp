@@ -1,9 +1,12 @@
 #include <PeleLMeX.H>
 #include <AMReX_TagBox.H>
+#include <AMReX_MultiFabUtil.H>
 #ifdef AMREX_USE_EB
 #include <AMReX_EBAmrUtil.H>
 #endif
 
+#include <algorithm>
+
 using namespace amrex;
 
 void
@@ -22,12 +25,50 @@ PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
   }
 #endif
 
-  for (const auto& errTag : errTags) {
+  // Collect the fields required by the refinement criteria and derive them
+  // all at once, each field only once
+  Vector<std::string> tagFields;
+  Vector<int> tagFieldComp(errTags.size(), -1);
+  int tagNGrow = 0;
+  for (int n = 0; n < errTags.size(); ++n) {
+    const std::string& field = errTags[n].Field();
+    if (field.empty()) {
+      continue;
+    }
+    auto it = std::find(tagFields.begin(), tagFields.end(), field);
+    tagFieldComp[n] = static_cast<int>(it - tagFields.begin());
+    if (it == tagFields.end()) {
+      tagFields.push_back(field);
+    }
+    tagNGrow = std::max(tagNGrow, errTags[n].NGrow());
+  }
+  std::unique_ptr<MultiFab> tagData;
+  if (!tagFields.empty()) {
+    tagData = deriveMulti(tagFields, time, lev, tagNGrow);
+  }
+
+  for (int n = 0; n < errTags.size(); ++n) {
     std::unique_ptr<MultiFab> mf;
-    if (!errTag.Field().empty()) {
-      mf = deriveComp(errTag.Field(), time, lev, errTag.NGrow());
+    if (tagFieldComp[n] >= 0) {
+      mf = std::make_unique<MultiFab>(
+        *tagData, amrex::make_alias, tagFieldComp[n], 1);
     }
-    errTag(tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, lev, geom[lev]);
+    errTags[n](
+      tags, mf.get(), TagBox::CLEAR, TagBox::SET, time, lev, geom[lev]);
+  }
+
+  // Clear the tags of the inert regions, before the tags are extended
+  // toward the fresh gases
+  if (m_derefine != 0 && lev < m_derefineMaxLevel) {
+    derefineTags(lev, tags, time);
+  }
+
+  // Tag ahead of the moving features until the next regrid. Not when
+  // checking the drift of the tags, predicted tags being ahead of the grids
+  if (
+    (m_predictiveTagging != 0) && (m_regrid_int > 0) && (m_dt > 0.0) &&
+    !m_regridCheck) {
+    predictTags(lev, tags);
   }
 
 #ifdef AMREX_USE_EB
@@ -79,3 +120,284 @@ PeleLM::ErrorEst(int lev, TagBoxArray& tags, Real time, int /*ng*/)
   }
 #endif
 }
+
+void
+PeleLM::predictTags(int lev, TagBoxArray& tags)
+{
+  BL_PROFILE("PeleLMeX::predictTags()");
+
+  // Each tag is swept along the local velocity over the time to the next
+  // regrid, and widened by the flame displacement in every direction. The
+  // sweep is done one direction at a time using the velocity of the
+  // receiving cell, and is limited to m_predTagMaxCells.
+  const Real sweepTime = static_cast<Real>(regridInterval(lev)) * m_dt;
+  const Real flameSpeed = m_predTagFlameSpeed;
+  const int nMax = m_predTagMaxCells;
+  const auto dx = geom[lev].CellSizeArray();
+  const auto& state = getLevelDataPtr(lev, AmrNewTime)->state;
+
+  iMultiFab tagMF(grids[lev], dmap[lev], 1, nMax);
+  iMultiFab sweptMF(grids[lev], dmap[lev], 1, nMax);
+  tagMF.setVal(0);
+  sweptMF.setVal(0);
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(tags, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    const auto& bx = mfi.tilebox();
+    auto const& tag = tags.const_array(mfi);
+    auto const& tagInt = tagMF.array(mfi);
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      tagInt(i, j, k) = (tag(i, j, k) == TagBox::SET) ? 1 : 0;
+    });
+  }
+
+  for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+    // Ghost cells outside of the domain and of the level grids hold no tag
+    tagMF.setBndry(0);
+    tagMF.FillBoundary(geom[lev].periodicity());
+    const Real cellTime = sweepTime / dx[idim];
+    const Real flameCells = flameSpeed * cellTime;
+    auto const& src = tagMF.const_arrays();
+    auto const& dst = sweptMF.arrays();
+    auto const& vel = state.const_arrays();
+    amrex::ParallelFor(
+      sweptMF, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+        // A tag moved by disp cells covers [min(0,disp), max(0,disp)]
+        const Real disp = vel[box_no](i, j, k, VELX + idim) * cellTime;
+        const Real lo = amrex::min(0.0_rt, disp) - flameCells;
+        const Real hi = amrex::max(0.0_rt, disp) + flameCells;
+        const int nlo = amrex::max(-nMax, static_cast<int>(std::floor(lo)));
+        const int nhi = amrex::min(nMax, static_cast<int>(std::ceil(hi)));
+        int swept = 0;
+        IntVect iv(AMREX_D_DECL(i, j, k));
+        const int i0 = iv[idim];
+        for (int n = nlo; n <= nhi && swept == 0; ++n) {
+          iv[idim] = i0 - n;
+          swept = src[box_no](iv);
+        }
+        dst[box_no](i, j, k) = swept;
+      });
+    std::swap(tagMF, sweptMF);
+  }
+
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+  for (MFIter mfi(tags, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+    const auto& bx = mfi.tilebox();
+    auto const& tag = tags.array(mfi);
+    auto const& tagInt = tagMF.const_array(mfi);
+    amrex::ParallelFor(bx, [=] AMREX_GPU_DEVICE(int i, int j, int k) noexcept {
+      if (tagInt(i, j, k) != 0) {
+        tag(i, j, k) = TagBox::SET;
+      }
+    });
+  }
+  Gpu::streamSynchronize();
+}
+
+void
+PeleLM::derefineTags(int lev, TagBoxArray& tags, Real time)
+{
+  BL_PROFILE("PeleLMeX::derefineTags()");
+
+  // Carry the inert counters over to the current grids
+  auto& count = m_derefineCount[lev];
+  if (
+    !count || count->boxArray() != grids[lev] ||
+    count->DistributionMap() != dmap[lev]) {
+    auto newCount = std::make_unique<iMultiFab>(grids[lev], dmap[lev], 1, 0);
+    newCount->setVal(0);
+    if (count) {
+      newCount->ParallelCopy(*count, 0, 0, 1);
+    }
+    count = std::move(newCount);
+  }
+
+  // Criteria: adjacent differences of temperature and species mass
+  // fractions, absolute heat release
+  Vector<std::string> fields;
+  Vector<Real> thresholds;
+  Vector<int> isDiff;
+  if (m_derefineTempDiff > 0.0) {
+    fields.push_back("temp");
+    thresholds.push_back(m_derefineTempDiff);
+    isDiff.push_back(1);
+  }
+  if (m_derefineSpecDiff > 0.0) {
+    for (const auto& spec : m_derefineSpecies) {
+      fields.push_back("Y(" + spec + ")");
+      thresholds.push_back(m_derefineSpecDiff);
+      isDiff.push_back(1);
+    }
+  }
+  if (m_derefineHeatRelease > 0.0) {
+    fields.push_back("HeatRelease");
+    thresholds.push_back(m_derefineHeatRelease);
+    isDiff.push_back(0);
+  }
+  auto fieldData = deriveMulti(fields, time, lev, 1);
+
+  // Activity: largest criterion relative to its threshold
+  MultiFab activity(grids[lev], dmap[lev], 1, 0);
+  activity.setVal(0.0);
+  for (int n = 0; n < fields.size(); ++n) {
+    const Real invThreshold = 1.0 / thresholds[n];
+    const bool diff = (isDiff[n] != 0);
+    auto const& field = fieldData->const_arrays();
+    auto const& act = activity.arrays();
+    amrex::ParallelFor(
+      activity, [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+        const IntVect iv(AMREX_D_DECL(i, j, k));
+        auto const& f = field[box_no];
+        Real val = std::abs(f(iv, n));
+        if (diff) {
+          val = 0.0;
+          for (int idim = 0; idim < AMREX_SPACEDIM; ++idim) {
+            const IntVect shift = IntVect::TheDimensionVector(idim);
+            val = amrex::max(
+              val, std::abs(f(iv + shift, n) - f(iv, n)),
+              std::abs(f(iv, n) - f(iv - shift, n)));
+          }
+        }
+        act[box_no](i, j, k) =
+          amrex::max(act[box_no](i, j, k), val * invThreshold);
+      });
+  }
+  Gpu::streamSynchronize();
+
+  // Cells count as inert below the thresholds, and are only reset once
+  // above the thresholds times the hysteresis factor. Tags are cleared in
+  // cells inert for m_derefineNRegrids consecutive regrids.
+  const int nRegrids = m_derefineNRegrids;
+  const Real hysteresis = m_derefineHysteresis;
+  const bool update = m_derefineUpdate;
+#ifdef AMREX_USE_EB
+  const bool keepCutCells =
+    (m_EB_refine_type == "Static" && lev < m_EB_refine_LevMax) ||
+    (m_EB_refine_type == "Adaptive" && lev < m_EB_refine_LevAdapt);
+#endif
+  ReduceOps<ReduceOpSum> reduce_op;
+  ReduceData<Long> reduce_data(reduce_op);
+  using ReduceTuple = typename decltype(reduce_data)::Type;
+  for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+    const Box& bx = mfi.validbox();
+    auto const& tag = tags.array(mfi);
+    auto const& cnt = count->array(mfi);
+    auto const& act = activity.const_array(mfi);
+#ifdef AMREX_USE_EB
+    auto const& vfrac = EBFactory(lev).getVolFrac().const_array(mfi);
+#endif
+    reduce_op.eval(
+      bx, reduce_data,
+      [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+        int c = cnt(i, j, k);
+        if (act(i, j, k) < 1.0) {
+          c = amrex::min(c + 1, nRegrids);
+        } else if (act(i, j, k) > hysteresis) {
+          c = 0;
+        }
+        if (update) {
+          cnt(i, j, k) = c;
+        }
+#ifdef AMREX_USE_EB
+        if (keepCutCells && vfrac(i, j, k) > 0.0 && vfrac(i, j, k) < 1.0) {
+          return {0};
+        }
+#endif
+        if (c >= nRegrids && tag(i, j, k) == TagBox::SET) {
+          tag(i, j, k) = TagBox::CLEAR;
+          return {1};
+        }
+        return {0};
+      });
+  }
+  Long nCleared = amrex::get<0>(reduce_data.value(reduce_op));
+
+  if (m_verbose > 1 && update) {
+    ParallelDescriptor::ReduceLongSum(nCleared);
+    Print() << " Derefinement cleared " << nCleared << " tags on level "
+            << lev << "\n";
+  }
+}
+
+int
+PeleLM::regridInterval(int lev) const
+{
+  if (m_regridOnDemand == 0 && !m_regridLevelInt.empty()) {
+    return m_regridLevelInt[std::min(lev, max_level - 1)];
+  }
+  return m_regrid_int;
+}
+
+int
+PeleLM::regridNeeded()
+{
+  BL_PROFILE("PeleLMeX::regridNeeded()");
+
+  // On each level that can be refined, count the tags with a cell not
+  // covered by the next finer level within m_regridDriftBuffer cells. On the
+  // finest level, any tag requires a new level.
+  const int nBuf = m_regridDriftBuffer;
+  for (int lev = 0; lev < max_level && lev <= finest_level; ++lev) {
+    TagBoxArray tags(grids[lev], dmap[lev], 0);
+    m_regridCheck = true;
+    ErrorEst(lev, tags, m_cur_time, 0);
+    m_regridCheck = false;
+
+    iMultiFab fineMask;
+    if (lev < finest_level) {
+      fineMask = makeFineMask(
+        grids[lev], dmap[lev], IntVect(nBuf), grids[lev + 1], refRatio(lev),
+        geom[lev].periodicity(), 0, 1);
+    } else {
+      fineMask.define(grids[lev], dmap[lev], 1, nBuf);
+      fineMask.setVal(0);
+    }
+    const Box domain = geom[lev].growPeriodicDomain(nBuf);
+
+    ReduceOps<ReduceOpSum, ReduceOpSum> reduce_op;
+    ReduceData<Long, Long> reduce_data(reduce_op);
+    using ReduceTuple = typename decltype(reduce_data)::Type;
+    for (MFIter mfi(tags); mfi.isValid(); ++mfi) {
+      const Box& bx = mfi.validbox();
+      auto const& tag = tags.const_array(mfi);
+      auto const& fine = fineMask.const_array(mfi);
+      reduce_op.eval(
+        bx, reduce_data,
+        [=] AMREX_GPU_DEVICE(int i, int j, int k) -> ReduceTuple {
+          if (tag(i, j, k) != TagBox::SET) {
+            return {0, 0};
+          }
+          const IntVect iv(AMREX_D_DECL(i, j, k));
+          const Box nbx = amrex::grow(Box(iv, iv), nBuf) & domain;
+          Long drift = 0;
+          amrex::Loop(nbx, [&](int ii, int jj, int kk) {
+            if (fine(ii, jj, kk) == 0) {
+              drift = 1;
+            }
+          });
+          return {1, drift};
+        });
+    }
+    auto hv = reduce_data.value(reduce_op);
+    Long counts[2] = {amrex::get<0>(hv), amrex::get<1>(hv)};
+    ParallelDescriptor::ReduceLongSum(counts, 2);
+
+    const Long nTags = counts[0];
+    const Long nDrift = counts[1];
+    const Real driftFrac =
+      (nTags > 0) ? static_cast<Real>(nDrift) / static_cast<Real>(nTags) : 0.0;
+    if (nDrift > 0 && driftFrac > m_regridDriftFrac) {
+      if (m_verbose > 0) {
+        Print() << " Regrid triggered on level " << lev << ": " << nDrift
+                << " of " << nTags << " tags within " << nBuf
+                << " cells of the fine grids edge\n";
+      }
+      return lev;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,161 @@
+#include "PeleLMeX_TemporalFile.H"
+
+#include <AMReX.H>
+#include <AMReX_Utility.H>
+
+#include <cstdint>
+#include <cstring>
+
+TemporalFile::~TemporalFile() { close(); }
+
+void
+TemporalFile::open(
+  const std::string& a_name,
+  const amrex::Vector<std::string>& a_columns,
+  int a_binary,
+  int a_bufferRows)
+{
+  m_columns = a_columns;
+  m_binary = a_binary;
+  m_bufferRows = std::max(1, a_bufferRows);
+  m_nRows = 0;
+  m_buffer.clear();
+
+  if (m_binary == 0) {
+    m_file.open(
+      a_name.c_str(), std::ios::out | std::ios::app | std::ios_base::binary);
+    if (!m_file.good()) {
+      amrex::FileOpenFailed(a_name);
+    }
+    m_file.precision(12);
+    return;
+  }
+
+  const std::string fileName = a_name + ".bin";
+  const auto ncols = static_cast<std::int32_t>(m_columns.size());
+
+  // Appending to an existing file (restart): check the columns are the same
+  bool writeHeader = true;
+  {
+    std::ifstream existing(fileName.c_str(), std::ios::in | std::ios::binary);
+    if (
+      existing.good() &&
+      existing.peek() != std::ifstream::traits_type::eof()) {
+      char fileMagic[8];
+      std::int32_t fileNcols = 0;
+      existing.read(fileMagic, 8);
+      existing.read(reinterpret_cast<char*>(&fileNcols), sizeof(fileNcols));
+      bool match = existing.good() &&
+                   std::strncmp(fileMagic, magic, 8) == 0 &&
+                   fileNcols == ncols;
+      for (int c = 0; match && c < ncols; ++c) {
+        std::int32_t len = 0;
+        existing.read(reinterpret_cast<char*>(&len), sizeof(len));
+        match = existing.good() && len >= 0 &&
+                len == static_cast<std::int32_t>(m_columns[c].size());
+        if (match) {
+          std::string col(len, '\0');
+          existing.read(col.data(), len);
+          match = existing.good() && col == m_columns[c];
+        }
+      }
+      if (!match) {
+        amrex::Abort(
+          "Existing temporal file " + fileName +
+          " does not match the current temporal columns");
+      }
+      writeHeader = false;
+    }
+  }
+
+  m_file.open(
+    fileName.c_str(), std::ios::out | std::ios::app | std::ios_base::binary);
+  if (!m_file.good()) {
+    amrex::FileOpenFailed(fileName);
+  }
+  if (writeHeader) {
+    m_file.write(magic, 8);
+    m_file.write(reinterpret_cast<const char*>(&ncols), sizeof(ncols));
+    for (const auto& col : m_columns) {
+      const auto len = static_cast<std::int32_t>(col.size());
+      m_file.write(reinterpret_cast<const char*>(&len), sizeof(len));
+      m_file.write(col.data(), len);
+    }
+  }
+  m_buffer.reserve(m_columns.size() * m_bufferRows);
+}
+
+void
+TemporalFile::writeAsciiComment(const std::string& a_comment)
+{
+  if (m_binary == 0 && m_file.is_open()) {
+    m_file << a_comment << "\n";
+  }
+}
+
+void
+TemporalFile::addRow(const amrex::Vector<amrex::Real>& a_row)
+{
+  if (!m_file.is_open()) {
+    return;
+  }
+
+  if (m_binary == 0) {
+    for (int n = 0; n < a_row.size(); ++n) {
+      m_file << (n > 0 ? " " : "") << a_row[n];
+    }
+    m_file << "\n";
+  } else {
+    AMREX_ALWAYS_ASSERT(a_row.size() == m_columns.size());
+    m_buffer.insert(m_buffer.end(), a_row.begin(), a_row.end());
+  }
+
+  if (++m_nRows >= m_bufferRows) {
+    flush();
+  }
+}
+
+void
+TemporalFile::writeBinaryChunk()
+{
+  if (m_nRows == 0) {
+    return;
+  }
+  // Transpose the buffered rows into columns
+  const auto nrows = static_cast<std::int32_t>(m_nRows);
+  const int ncols = static_cast<int>(m_columns.size());
+  amrex::Vector<double> chunk(m_buffer.size());
+  for (int r = 0; r < m_nRows; ++r) {
+    for (int c = 0; c < ncols; ++c) {
+      chunk[c * m_nRows + r] = m_buffer[r * ncols + c];
+    }
+  }
+  m_file.write(reinterpret_cast<const char*>(&nrows), sizeof(nrows));
+  m_file.write(
+    reinterpret_cast<const char*>(chunk.data()),
+    static_cast<std::streamsize>(chunk.size() * sizeof(double)));
+  m_buffer.clear();
+}
+
+void
+TemporalFile::flush()
+{
+  if (!m_file.is_open()) {
+    return;
+  }
+  if (m_binary != 0) {
+    writeBinaryChunk();
+  }
+  m_nRows = 0;
+  m_file.flush();
+}
+
+void
+TemporalFile::close()
+{
+  if (!m_file.is_open()) {
+    return;
+  }
+  flush();
+  m_file.close();
+}
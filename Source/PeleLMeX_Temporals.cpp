@@ -27,8 +27,10 @@ PeleLM::initTemporals(const PeleLM::TimeStamp& a_time)
   }
 
   if ((m_do_speciesBalance != 0) && (m_incompressible == 0)) {
+    auto rhoYOld =
+      MFSum(GetVecOfConstPtrs(getSpeciesVect(a_time)), 0, NUM_SPECIES);
     for (int n = 0; n < NUM_SPECIES; n++) {
-      m_RhoYOld[n] = MFSum(GetVecOfConstPtrs(getSpeciesVect(a_time)), n);
+      m_RhoYOld[n] = rhoYOld[n];
       for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
         m_domainRhoYFlux[2 * n * AMREX_SPACEDIM + 2 * idim] = 0.0;
         m_domainRhoYFlux[1 + 2 * n * AMREX_SPACEDIM + 2 * idim] = 0.0;
@@ -48,26 +50,25 @@ PeleLM::massBalance()
     +m_domainMassFlux[2] + m_domainMassFlux[3],
     +m_domainMassFlux[4] + m_domainMassFlux[5]);
 
-  tmpMassFile << m_nstep << " " << m_cur_time // Time info
-              << " " << m_massNew             // mass
-              << " " << dmdt                  // mass temporal derivative
-              << " " << massFluxBalance       // domain boundaries mass fluxes
-              << " " << std::abs(dmdt - massFluxBalance) << " \n"; // balance
-  tmpMassFile.flush();
+  tmpMassFile.addRow(
+    {static_cast<Real>(m_nstep), m_cur_time, // Time info
+     m_massNew,                              // mass
+     dmdt,                                   // mass temporal derivative
+     massFluxBalance,                        // domain boundaries mass fluxes
+     std::abs(dmdt - massFluxBalance)});     // balance
 }
 
 void
 PeleLM::speciesBalancePatch()
 {
-  tmppatchmfrFile << m_nstep << " " << m_cur_time; // Time info
+  Vector<Real> row{static_cast<Real>(m_nstep), m_cur_time}; // Time info
   for (int n = 0; n < m_bPatches.size(); n++) {
     BPatch::BpatchDataContainer* bphost = m_bPatches[n]->getHostDataPtr();
     for (int i = 0; i < bphost->num_species; i++) {
-      tmppatchmfrFile << " " << bphost->speciesFlux[i];
+      row.push_back(bphost->speciesFlux[i]);
     }
   }
-  tmppatchmfrFile << "\n";
-  tmppatchmfrFile.flush();
+  tmppatchmfrFile.addRow(row);
 }
 
 void
@@ -76,10 +77,11 @@ PeleLM::speciesBalance()
   // Compute the species rhoY balance on the computational domain
   Array<Real, NUM_SPECIES> dmYdt;
   Array<Real, NUM_SPECIES> massYFluxBalance;
-  Array<Real, NUM_SPECIES> rhoYdots;
+  auto rhoYNew =
+    MFSum(GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)), 0, NUM_SPECIES);
+  auto rhoYdots = MFSum(GetVecOfConstPtrs(getIRVect()), 0, NUM_SPECIES);
   for (int n = 0; n < NUM_SPECIES; n++) {
-    m_RhoYNew[n] = MFSum(GetVecOfConstPtrs(getSpeciesVect(AmrNewTime)), n);
-    rhoYdots[n] = MFSum(GetVecOfConstPtrs(getIRVect()), n);
+    m_RhoYNew[n] = rhoYNew[n];
     dmYdt[n] = (m_RhoYNew[n] - m_RhoYOld[n]) / m_dt;
     massYFluxBalance[n] = AMREX_D_TERM(
       m_domainRhoYFlux[2 * n * AMREX_SPACEDIM] +
@@ -90,18 +92,16 @@ PeleLM::speciesBalance()
         m_domainRhoYFlux[2 * n * AMREX_SPACEDIM + 5]);
   }
 
-  tmpSpecFile << m_nstep << " " << m_cur_time; // Time info
+  Vector<Real> row{static_cast<Real>(m_nstep), m_cur_time}; // Time info
   for (int n = 0; n < NUM_SPECIES; n++) {
-    tmpSpecFile << " " << m_RhoYNew[n]        // mass of Y
-                << " " << dmYdt[n]            // mass temporal derivative
-                << " " << massYFluxBalance[n] // domain boundaries mass fluxes
-                << " " << rhoYdots[n]         // integrated consumption rate
-                << " "
-                << std::abs(
-                     dmYdt[n] - massYFluxBalance[n] - rhoYdots[n]); // balance
-  }
-  tmpSpecFile << "\n";
-  tmpSpecFile.flush();
+    row.push_back(m_RhoYNew[n]);        // mass of Y
+    row.push_back(dmYdt[n]);            // mass temporal derivative
+    row.push_back(massYFluxBalance[n]); // domain boundaries mass fluxes
+    row.push_back(rhoYdots[n]);         // integrated consumption rate
+    row.push_back(
+      std::abs(dmYdt[n] - massYFluxBalance[n] - rhoYdots[n])); // balance
+  }
+  tmpSpecFile.addRow(row);
 }
 
 void
@@ -310,12 +310,21 @@ PeleLM::rhoHBalance()
     +m_domainRhoHFlux[2] + m_domainRhoHFlux[3],
     +m_domainRhoHFlux[4] + m_domainRhoHFlux[5]);
 
-  tmpMassFile << m_nstep << " " << m_cur_time // Time info
-              << " " << m_RhoHNew             // RhoH
-              << " " << dRhoHdt               // RhoH temporal derivative
-              << " " << rhoHFluxBalance       // domain boundaries RhoH fluxes
-              << " " << std::abs(dRhoHdt - rhoHFluxBalance) << " \n"; // balance
-  tmpMassFile.flush();
+  // Own file: the rows of the mass balance have the same columns
+  if (
+    (m_do_temporals != 0) && ParallelDescriptor::IOProcessor() &&
+    !tmpRhoHFile.isOpen()) {
+    tmpRhoHFile.open(
+      "temporals/tempRhoH",
+      {"step", "time", "integral", "ddt", "boundary_flux", "balance_error"},
+      m_temporalBinary, m_temporalBufferRows);
+  }
+  tmpRhoHFile.addRow(
+    {static_cast<Real>(m_nstep), m_cur_time,  // Time info
+     m_RhoHNew,                               // RhoH
+     dRhoHdt,                                 // RhoH temporal derivative
+     rhoHFluxBalance,                         // domain boundaries RhoH fluxes
+     std::abs(dRhoHdt - rhoHFluxBalance)});   // balance
 }
 
 void
@@ -656,46 +665,63 @@ PeleLM::writeTemporals()
     kinEnergy[lev] = derive("kinetic_energy", m_cur_time, lev, 0);
     enstrophy[lev] = derive("enstrophy", m_cur_time, lev, 0);
   }
-  Real kinenergy_int = MFSum(GetVecOfConstPtrs(kinEnergy), 0);
-  Real enstrophy_int = MFSum(GetVecOfConstPtrs(enstrophy), 0);
-
   // Combustion
   Real fuelConsumptionInt = 0.0;
   Real heatReleaseRateInt = 0.0;
+  Vector<Vector<const MultiFab*>> integrands{
+    GetVecOfConstPtrs(kinEnergy), GetVecOfConstPtrs(enstrophy)};
+  Vector<int> integrandComps{0, 0};
+  Vector<std::unique_ptr<MultiFab>> heatRelease;
   if (fuelID >= 0 && !(m_chem_integrator == "ReactorNull")) {
-    fuelConsumptionInt = MFSum(GetVecOfConstPtrs(getIRVect()), fuelID);
+    heatRelease.resize(finest_level + 1);
     for (int lev = 0; lev <= finest_level; ++lev) {
-      getHeatRelease(lev, kinEnergy[lev].get()); // Reuse kinEnergy container
+      heatRelease[lev] =
+        std::make_unique<MultiFab>(grids[lev], dmap[lev], 1, 0);
+      getHeatRelease(lev, heatRelease[lev].get());
     }
-    heatReleaseRateInt = MFSum(GetVecOfConstPtrs(kinEnergy), 0);
-  }
-
-  tmpStateFile << m_nstep << " " << m_cur_time << " " << m_dt // Time
-               << " " << kinenergy_int                        // Kinetic energy
-               << " " << enstrophy_int                        // Enstrophy
-               << " " << m_pNew             // Thermo. pressure
-               << " " << fuelConsumptionInt // Integ fuel burning rate
-               << " " << heatReleaseRateInt // Integ heat release rate
-               << " \n";
-  tmpStateFile.flush();
-
-  // Get min/max for state components
-  auto stateMax =
-    (m_incompressible) != 0
-      ? MLmax(GetVecOfConstPtrs(getStateVect(AmrNewTime)), 0, AMREX_SPACEDIM)
-      : MLmax(GetVecOfConstPtrs(getStateVect(AmrNewTime)), 0, NVAR);
-  auto stateMin =
-    (m_incompressible) != 0
-      ? MLmin(GetVecOfConstPtrs(getStateVect(AmrNewTime)), 0, AMREX_SPACEDIM)
-      : MLmin(GetVecOfConstPtrs(getStateVect(AmrNewTime)), 0, NVAR);
-
-  tmpExtremasFile << m_nstep << " " << m_cur_time; // Time
-  for (int n = 0; n < stateMax.size();
-       ++n) { // Min & max of each state variable
-    tmpExtremasFile << " " << stateMin[n] << " " << stateMax[n];
-  }
-  tmpExtremasFile << " \n";
-  tmpExtremasFile.flush();
+    integrands.push_back(GetVecOfConstPtrs(getIRVect()));
+    integrandComps.push_back(fuelID);
+    integrands.push_back(GetVecOfConstPtrs(heatRelease));
+    integrandComps.push_back(0);
+  }
+
+  // Integrate all at once
+  auto integrals = MFSum(integrands, integrandComps);
+  Real kinenergy_int = integrals[0];
+  Real enstrophy_int = integrals[1];
+  if (fuelID >= 0 && !(m_chem_integrator == "ReactorNull")) {
+    fuelConsumptionInt = integrals[2];
+    heatReleaseRateInt = integrals[3];
+  }
+
+  Vector<Real> stateRow{
+    static_cast<Real>(m_nstep), m_cur_time, m_dt, // Time
+    kinenergy_int,                                // Kinetic energy
+    enstrophy_int,                                // Enstrophy
+    m_pNew,                                       // Thermo. pressure
+    fuelConsumptionInt,                           // Integ fuel burning rate
+    heatReleaseRateInt};                          // Integ heat release rate
+  if (m_sdcAdaptive != 0) {
+    stateRow.push_back(m_nSDCdone); // Number of SDC iterations
+  }
+  tmpStateFile.addRow(stateRow);
+
+  // Get min/max for state components, in a single sweep/reduction
+  if (m_do_extremas != 0) {
+    Vector<Real> stateMax;
+    Vector<Real> stateMin;
+    MLminmax(
+      GetVecOfConstPtrs(getStateVect(AmrNewTime)), 0,
+      (m_incompressible) != 0 ? AMREX_SPACEDIM : NVAR, stateMin, stateMax);
+
+    Vector<Real> row{static_cast<Real>(m_nstep), m_cur_time}; // Time
+    for (int n = 0; n < stateMax.size();
+         ++n) { // Min & max of each state variable
+      row.push_back(stateMin[n]);
+      row.push_back(stateMax[n]);
+    }
+    tmpExtremasFile.addRow(row);
+  }
 
 #ifdef PELE_USE_EFIELD
   if (m_do_ionsBalance) {
@@ -707,6 +733,11 @@ PeleLM::writeTemporals()
 void
 PeleLM::openTempFile()
 {
+  if (m_do_perfTrace != 0) {
+    m_perfTrace.open(
+      max_level, m_perfTraceInt, m_perfTraceBinary, m_perfTraceBufferRows);
+  }
+
   if (m_do_temporals == 0) {
     return;
   }
@@ -715,56 +746,82 @@ PeleLM::openTempFile()
   UtilCreateDirectory("temporals", 0755);
 
   if (ParallelDescriptor::IOProcessor()) {
-    std::string tempFileName = "temporals/tempState";
+    const Vector<std::string> timeCols{"step", "time"};
+    Vector<std::string> cols = timeCols;
+    for (const auto* col :
+         {"dt", "kinetic_energy", "enstrophy", "thermo_pressure",
+          "fuel_consumption", "heat_release"}) {
+      cols.emplace_back(col);
+    }
+    if (m_sdcAdaptive != 0) {
+      cols.emplace_back("sdc_iterations");
+    }
     tmpStateFile.open(
-      tempFileName.c_str(),
-      std::ios::out | std::ios::app | std::ios_base::binary);
-    tmpStateFile.precision(12);
+      "temporals/tempState", cols, m_temporalBinary, m_temporalBufferRows);
     if (m_do_massBalance != 0) {
-      tempFileName = "temporals/tempMass";
+      cols = timeCols;
+      for (const auto* col :
+           {"integral", "ddt", "boundary_flux", "balance_error"}) {
+        cols.emplace_back(col);
+      }
       tmpMassFile.open(
-        tempFileName.c_str(),
-        std::ios::out | std::ios::app | std::ios_base::binary);
-      tmpMassFile.precision(12);
+        "temporals/tempMass", cols, m_temporalBinary, m_temporalBufferRows);
     }
     if (m_do_speciesBalance != 0) {
-      tempFileName = "temporals/tempSpecies";
+      Vector<std::string> names;
+      pele::physics::eos::speciesNames<pele::physics::PhysicsType::eos_type>(
+        names);
+      cols = timeCols;
+      for (const auto& name : names) {
+        for (const auto* col : {"rhoY_", "ddt_", "flux_", "wdot_", "error_"}) {
+          cols.emplace_back(col + name);
+        }
+      }
       tmpSpecFile.open(
-        tempFileName.c_str(),
-        std::ios::out | std::ios::app | std::ios_base::binary);
-      tmpSpecFile.precision(12);
+        "temporals/tempSpecies", cols, m_temporalBinary, m_temporalBufferRows);
     }
     if (m_do_extremas != 0) {
-      tempFileName = "temporals/tempExtremas";
+      const int nExtremas = (m_incompressible) != 0 ? AMREX_SPACEDIM : NVAR;
+      Vector<std::string> varNames(nExtremas);
+      for (const auto& [idx, name] : stateComponents) {
+        if (idx < nExtremas) {
+          varNames[idx] = name;
+        }
+      }
+      cols = timeCols;
+      for (const auto& name : varNames) {
+        cols.emplace_back("min_" + name);
+        cols.emplace_back("max_" + name);
+      }
       tmpExtremasFile.open(
-        tempFileName.c_str(),
-        std::ios::out | std::ios::app | std::ios_base::binary);
-      tmpExtremasFile.precision(12);
+        "temporals/tempExtremas", cols, m_temporalBinary,
+        m_temporalBufferRows);
     }
     if (m_do_patch_mfr != 0) {
-      tempFileName = "temporals/temppatchmfr";
-      tmppatchmfrFile.open(
-        tempFileName.c_str(),
-        std::ios::out | std::ios::app | std::ios_base::binary);
-      tmppatchmfrFile.precision(12);
-      tmppatchmfrFile << "#Variables=iter,time";
+      cols = timeCols;
+      std::string header{"#Variables=iter,time"};
       for (int n = 0; n < m_bPatches.size(); n++) {
         BPatch* patch = m_bPatches[n].get();
         BPatch::BpatchDataContainer bphost = patch->getHostData();
         for (int i = 0; i < bphost.num_species; i++) {
-          tmppatchmfrFile << ","
-                          << patch->m_patchname + "_" + patch->speciesList[i];
+          cols.emplace_back(patch->m_patchname + "_" + patch->speciesList[i]);
+          header += "," + cols.back();
         }
       }
-      tmppatchmfrFile << "\n";
+      tmppatchmfrFile.open(
+        "temporals/temppatchmfr", cols, m_temporalBinary,
+        m_temporalBufferRows);
+      tmppatchmfrFile.writeAsciiComment(header);
     }
 #ifdef PELE_USE_EFIELD
     if (m_do_ionsBalance) {
-      tempFileName = "temporals/tempIons";
+      cols = timeCols;
+      for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
+        cols.emplace_back("ions_current_lo" + std::to_string(idim));
+        cols.emplace_back("ions_current_hi" + std::to_string(idim));
+      }
       tmpIonsFile.open(
-        tempFileName.c_str(),
-        std::ios::out | std::ios::app | std::ios_base::binary);
-      tmpIonsFile.precision(12);
+        "temporals/tempIons", cols, m_temporalBinary, m_temporalBufferRows);
     }
 #endif
   }
@@ -778,29 +835,31 @@ PeleLM::closeTempFile()
   }
 
   if (ParallelDescriptor::IOProcessor()) {
-    tmpStateFile.flush();
     tmpStateFile.close();
-    if (m_do_massBalance != 0) {
-      tmpMassFile.flush();
-      tmpMassFile.close();
-    }
-    if (m_do_speciesBalance != 0) {
-      tmpSpecFile.flush();
-      tmpSpecFile.close();
-    }
-    if (m_do_extremas != 0) {
-      tmpExtremasFile.flush();
-      tmpExtremasFile.close();
-    }
-    if (m_do_patch_mfr != 0) {
-      tmppatchmfrFile.flush();
-      tmppatchmfrFile.close();
-    }
+    tmpMassFile.close();
+    tmpRhoHFile.close();
+    tmpSpecFile.close();
+    tmpExtremasFile.close();
+    tmppatchmfrFile.close();
 #ifdef PELE_USE_EFIELD
-    if (m_do_ionsBalance) {
-      tmpIonsFile.flush();
-      tmpIonsFile.close();
-    }
+    tmpIonsFile.close();
 #endif
   }
 }
+
+void
+PeleLM::writePerfTrace()
+{
+  BL_PROFILE("PeleLMeX::writePerfTrace()");
+
+  const int myProc = ParallelDescriptor::MyProc();
+  Vector<Real> levelCells(finest_level + 1, 0.0);
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    for (int i = 0; i < grids[lev].size(); ++i) {
+      if (dmap[lev][i] == myProc) {
+        levelCells[lev] += static_cast<Real>(grids[lev][i].numPts());
+      }
+    }
+  }
+  m_perfTrace.write(m_nstep, m_cur_time, levelCells);
+}
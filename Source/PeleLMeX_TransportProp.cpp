@@ -289,15 +289,40 @@ PeleLM::calcDiffusivity(const TimeStamp& a_time)
   for (int lev = 0; lev <= finest_level; ++lev) {
 
     auto* ldata_p = getLevelDataPtr(lev, a_time);
+    const IntVect ng = ldata_p->diff_cc.nGrowVect();
 
     // Transport data pointer
     auto const* ltransparm = trans_parms.device_parm();
 
+    // Optionally work on a copy of rhoY, T on the compute layout
+    const Real strt_time = ParallelDescriptor::second();
+    const bool useLayout = m_computeLayout.use(
+      lev, ComputeLayout::Transport, grids[lev], dmap[lev]);
+    MultiFab layoutState;
+    MultiFab layoutDiff;
+#ifdef PELE_USE_EFIELD
+    MultiFab layoutMob;
+#endif
+    if (useLayout) {
+      const auto& ba = m_computeLayout.boxArray(lev);
+      const auto& dm = m_computeLayout.DistributionMap(lev);
+      layoutState.define(ba, dm, NVAR, ng);
+      layoutState.ParallelCopy(
+        ldata_p->state, FIRSTSPEC, FIRSTSPEC, NUM_SPECIES + 2, ng, ng);
+      layoutDiff.define(ba, dm, ldata_p->diff_cc.nComp(), ng);
+#ifdef PELE_USE_EFIELD
+      layoutMob.define(ba, dm, ldata_p->mob_cc.nComp(), ng);
+#endif
+    }
+    MultiFab& workDiff = useLayout ? layoutDiff : ldata_p->diff_cc;
+
     // MultiArrays
-    auto const& sma = ldata_p->state.const_arrays();
-    auto const& dma = ldata_p->diff_cc.arrays();
+    auto const& sma =
+      useLayout ? layoutState.const_arrays() : ldata_p->state.const_arrays();
+    auto const& dma = workDiff.arrays();
 #ifdef PELE_USE_EFIELD
-    auto const& kma = ldata_p->mob_cc.arrays();
+    auto const& kma =
+      useLayout ? layoutMob.arrays() : ldata_p->mob_cc.arrays();
     GpuArray<Real, NUM_SPECIES> mwt{0.0};
     {
       auto eos = pele::physics::PhysicsType::eos();
@@ -314,7 +339,7 @@ PeleLM::calcDiffusivity(const TimeStamp& a_time)
       do_soret ? 1
                : 0; // pass soret array, or pass mu as dummy (won't do anything)
     amrex::ParallelFor(
-      ldata_p->diff_cc, ldata_p->diff_cc.nGrowVect(),
+      workDiff, ng,
       [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
         getTransportCoeff(
           i, j, k, do_fixed_Le, do_fixed_Pr, do_soret, Le_inv, Pr_inv,
@@ -330,6 +355,19 @@ PeleLM::calcDiffusivity(const TimeStamp& a_time)
           Array4<Real>(kma[box_no], 0));
 #endif
       });
+    if (useLayout) {
+      ldata_p->diff_cc.ParallelCopy(
+        layoutDiff, 0, 0, layoutDiff.nComp(), ng, ng);
+#ifdef PELE_USE_EFIELD
+      ldata_p->mob_cc.ParallelCopy(layoutMob, 0, 0, layoutMob.nComp(), ng, ng);
+#endif
+    }
+    if (m_computeLayout.isActive()) {
+      Gpu::streamSynchronize();
+      m_computeLayout.record(
+        lev, ComputeLayout::Transport,
+        ParallelDescriptor::second() - strt_time);
+    }
   }
   Gpu::streamSynchronize();
 }
@@ -191,6 +191,8 @@ PeleLM::macProject(
 
   // Project
   macproj->project(m_mac_mg_rtol, m_mac_mg_atol);
+  m_perfTrace.addSolverIters(
+    PerfTrace::MACSolve, macproj->getMLMG().getNumIters());
 
   // Restore mac_divu
   if ((m_closed_chamber != 0) && (m_incompressible == 0)) {
@@ -2,6 +2,7 @@
 #include <PeleLMeX.H>
 #include <PeleLMeX_K.H>
 #include <hydro_utils.H>
+#include <algorithm>
 #include <memory>
 #ifdef PELE_USE_EFIELD
 #include <PeleLMeX_EF_Constants.H>
@@ -701,7 +702,9 @@ PeleLM::resetCoveredMask()
       Print() << " Resetting fine-covered cells mask \n";
     }
 
-    for (int lev = 0; lev < finest_level; ++lev) {
+    // Masks of the levels below m_resetCoveredMaskLev are unchanged
+    const int levStart = std::min(m_resetCoveredMaskLev, finest_level);
+    for (int lev = levStart; lev < finest_level; ++lev) {
       // Set a fine-covered mask
       BoxArray baf = grids[lev + 1];
       baf.coarsen(ref_ratio[lev]);
@@ -776,10 +779,17 @@ PeleLM::resetCoveredMask()
       loadBalanceChemLev(finest_level);
     }
 
+    // The volume weights need to account for the new covered mask
+    for (int lev = levStart; lev < m_volWgt.size(); ++lev) {
+      m_volWgt[lev].reset();
+    }
+
     // Switch off trigger
     m_resetCoveredMask = 0;
+    m_resetCoveredMaskLev = 0;
 
   } else {
+    m_resetCoveredMaskLev = 0;
     // Just load balance the chem. distribution map
     if (m_doLoadBalance != 0) {
       loadBalanceChem();
@@ -840,6 +850,11 @@ PeleLM::loadBalanceChemLev(int a_lev)
     test_dmap = DistributionMapping::makeKnapSack(
       new_cost, currentEfficiency, testEfficiency, nmax, false,
       ParallelDescriptor::IOProcessorNumber());
+
+  } else if (m_loadBalanceMethodChem == LoadBalanceMethod::Hierarchical) {
+
+    test_dmap = hierarchicalDistributionMap(
+      a_lev, new_cost, currentEfficiency, testEfficiency);
   }
 
   // IO proc determine if the test dmap offers significant improvements
@@ -1015,6 +1030,135 @@ PeleLM::deriveComp(const std::string& a_name, Real a_time, int lev, int nGrow)
   return mf;
 }
 
+// Return a unique_ptr with one component per requested variable, sharing
+// the fill-patched data and the derive evaluations among the variables
+std::unique_ptr<MultiFab>
+PeleLM::deriveMulti(
+  const Vector<std::string>& a_names,
+  Real a_time,
+  int lev,
+  int nGrow,
+  const Vector<int>* a_boxes)
+{
+  BL_PROFILE("PeleLMeX::deriveMulti()");
+  AMREX_ASSERT(nGrow >= 0);
+
+  // Layout: the level grids or a subset of their boxes
+  BoxArray ba = grids[lev];
+  DistributionMapping dm = dmap[lev];
+  if (a_boxes != nullptr) {
+    BoxList bl;
+    Vector<int> pmap;
+    for (const int i : *a_boxes) {
+      bl.push_back(grids[lev][i]);
+      pmap.push_back(dmap[lev][i]);
+    }
+    ba = BoxArray(std::move(bl));
+    dm = DistributionMapping(std::move(pmap));
+  }
+  const bool subset = (a_boxes != nullptr);
+  auto levelIndex = [subset, a_boxes](int a_idx) {
+    return subset ? (*a_boxes)[a_idx] : a_idx;
+  };
+
+  const int nVars = static_cast<int>(a_names.size());
+  auto mf = subset ? std::make_unique<MultiFab>(ba, dm, nVars, nGrow)
+                   : std::make_unique<MultiFab>(
+                       ba, dm, nVars, nGrow, MFInfo(), Factory(lev));
+
+  // Sort the requested variables: group the derived components by derive
+  // record such that each derive function is called once
+  Vector<const PeleLMDeriveRec*> recs;
+  Vector<Vector<std::pair<int, int>>> recComps;
+  Vector<std::pair<int, int>> stateComps;
+  Vector<std::pair<int, int>> reactComps;
+  for (int n = 0; n < nVars; ++n) {
+    const std::string& name = a_names[n];
+    const PeleLMDeriveRec* rec = derive_lst.get(name);
+    if (rec != nullptr) {
+      int derComp = rec->variableComp(name);
+      if (derComp < 0) {
+        amrex::Error(
+          "PeleLM::deriveMulti(): unknown derive component: " + name + " of " +
+          rec->variableName(1000));
+      }
+      auto it = std::find(recs.begin(), recs.end(), rec);
+      if (it == recs.end()) {
+        recs.push_back(rec);
+        recComps.emplace_back();
+        it = recs.end() - 1;
+      }
+      recComps[it - recs.begin()].emplace_back(n, derComp);
+    } else if (isStateVariable(name)) {
+      stateComps.emplace_back(n, stateVariableIndex(name));
+    } else if (isReactVariable(name)) {
+      reactComps.emplace_back(n, reactVariableIndex(name));
+    } else {
+      amrex::Error("PeleLM::deriveMulti(): unknown variable: " + name);
+    }
+  }
+
+  // Fill-patch the state and reaction data once for all the variables
+  std::unique_ptr<MultiFab> statemf;
+  if (!recs.empty() || !stateComps.empty()) {
+    if (subset) {
+      const int nGrowState = std::max(nGrow, m_nGrowState);
+      statemf = std::make_unique<MultiFab>(
+        ba, dm, (m_incompressible != 0) ? AMREX_SPACEDIM : NVAR, nGrowState);
+      fillpatch_state(lev, a_time, *statemf, nGrowState);
+    } else {
+      statemf = fillPatchState(lev, a_time, std::max(nGrow, m_nGrowState));
+    }
+  }
+  std::unique_ptr<MultiFab> reactmf;
+  if ((!recs.empty() && m_do_react != 0) || !reactComps.empty()) {
+    if (subset) {
+      reactmf = std::make_unique<MultiFab>(ba, dm, nCompIR(), nGrow);
+      fillpatch_reaction(lev, a_time, *reactmf, nGrow);
+    } else {
+      reactmf = fillPatchReact(lev, a_time, nGrow);
+    }
+  }
+
+  for (const auto& [n, idx] : stateComps) {
+    MultiFab::Copy(*mf, *statemf, idx, n, 1, nGrow);
+  }
+  for (const auto& [n, idx] : reactComps) {
+    MultiFab::Copy(*mf, *reactmf, idx, n, 1, nGrow);
+  }
+
+  if (!recs.empty()) {
+    // Get pressure: TODO no fillpatch for pressure just yet, simply get new
+    // state
+    auto* ldata_p = getLevelDataPtr(lev, AmrNewTime);
+    auto stateBCs = fetchBCRecArray(VELX, NVAR);
+    for (int r = 0; r < recs.size(); ++r) {
+      const PeleLMDeriveRec* rec = recs[r];
+      // Temp MF for all the derive components
+      MultiFab derTemp(ba, dm, rec->numDerive(), nGrow);
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+      for (MFIter mfi(derTemp, TilingIfNotGPU()); mfi.isValid(); ++mfi) {
+        const Box& bx = mfi.growntilebox(nGrow);
+        FArrayBox& derfab = derTemp[mfi];
+        FArrayBox const& statefab = (*statemf)[mfi];
+        FArrayBox const& pressfab = ldata_p->press[levelIndex(mfi.index())];
+        FArrayBox const& reactfab =
+          (m_incompressible) != 0 ? pressfab : (*reactmf)[mfi];
+        rec->derFunc()(
+          this, bx, derfab, 0, rec->numDerive(), statefab, reactfab, pressfab,
+          geom[lev], a_time, stateBCs, lev);
+      }
+      for (const auto& [n, derComp] : recComps[r]) {
+        MultiFab::Copy(*mf, derTemp, derComp, n, 1, nGrow);
+      }
+    }
+  }
+
+  return mf;
+}
+
 void
 PeleLM::initProgressVariable()
 {
@@ -1242,93 +1386,212 @@ PeleLM::fetchDiffTypeArray(int scomp, int ncomp)
   return types;
 }
 
+const MultiFab&
+PeleLM::getVolumeWeights(int a_lev)
+{
+  // Cell volume x EB volume fraction x fine-covered mask, used to compute
+  // integrals and extremas excluding fine-covered and EB-covered cells.
+  // Lazily rebuilt after the covered mask or the level layout changed.
+  if (
+    !m_volWgt[a_lev] || m_volWgt[a_lev]->boxArray() != grids[a_lev] ||
+    m_volWgt[a_lev]->DistributionMap() != dmap[a_lev]) {
+    BL_PROFILE("PeleLMeX::getVolumeWeights()");
+    m_volWgt[a_lev] =
+      std::make_unique<MultiFab>(grids[a_lev], dmap[a_lev], 1, 0);
+#ifdef AMREX_USE_EB
+    // For EB, use constant vol
+    const Real* dx = geom[a_lev].CellSize();
+    Real vol = AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+    auto const& ebfact =
+      dynamic_cast<EBFArrayBoxFactory const&>(Factory(a_lev));
+    MultiFab::Copy(*m_volWgt[a_lev], ebfact.getVolFrac(), 0, 0, 1, 0);
+    m_volWgt[a_lev]->mult(vol);
+#else
+    // Get the geometry volume to account for 2D-RZ
+    geom[a_lev].GetVolume(*m_volWgt[a_lev]);
+#endif
+    if (a_lev != finest_level) {
+      auto const& wma = m_volWgt[a_lev]->arrays();
+      auto const& mma = m_coveredMask[a_lev]->const_arrays();
+      amrex::ParallelFor(
+        *m_volWgt[a_lev],
+        [=] AMREX_GPU_DEVICE(int box_no, int i, int j, int k) noexcept {
+          wma[box_no](i, j, k) *= static_cast<Real>(mma[box_no](i, j, k));
+        });
+      Gpu::streamSynchronize();
+    }
+  }
+  return *m_volWgt[a_lev];
+}
+
 Real
 PeleLM::MFSum(const Vector<const MultiFab*>& a_mf, int comp)
+{
+  return MFSum(Vector<Vector<const MultiFab*>>{a_mf}, Vector<int>{comp})[0];
+}
+
+Vector<Real>
+PeleLM::MFSum(
+  const Vector<Vector<const MultiFab*>>& a_mfs, const Vector<int>& a_comps)
 {
   BL_PROFILE("PeleLMeX::MFSum()");
-  // Get the integral of the MF, not including the fine-covered and
-  // EB-covered cells
+  // Get the integrals of several MFs at once, not including the fine-covered
+  // and EB-covered cells, with a single parallel reduction
+  AMREX_ASSERT(a_mfs.size() == a_comps.size());
 
-  Real volwgtsum = 0.0;
+  const int nQuant = static_cast<int>(a_mfs.size());
+  Vector<Real> volwgtsum(nQuant, 0.0);
 
   for (int lev = 0; lev <= finest_level; ++lev) {
-#ifdef AMREX_USE_EB
-    // For EB, use constant vol
-    const Real* dx = geom[lev].CellSize();
-    Real vol = AMREX_D_TERM(dx[0], *dx[1], *dx[2]);
+    auto const& wgt = getVolumeWeights(lev);
+    for (int q = 0; q < nQuant; ++q) {
+      volwgtsum[q] += MFSumLocal(*a_mfs[q][lev], wgt, a_comps[q], 1)[0];
+    }
+  }
 
-    // Use amrex::ReduceSum
-    auto const& ebfact = dynamic_cast<EBFArrayBoxFactory const&>(Factory(lev));
-    auto const& vfrac = ebfact.getVolFrac();
+  ParallelDescriptor::ReduceRealSum(volwgtsum.data(), nQuant);
 
-    Real sm = 0.0;
-    if (lev != finest_level) {
-      sm = amrex::ReduceSum(
-        *a_mf[lev], vfrac, *m_coveredMask[lev], 0,
-        [vol, comp] AMREX_GPU_HOST_DEVICE(
-          Box const& bx, Array4<Real const> const& mf_arr,
-          Array4<Real const> const& vf_arr,
-          Array4<int const> const& covered_arr) -> Real {
-          Real sum = 0.0;
-          AMREX_LOOP_3D(bx, i, j, k, {
-            sum += mf_arr(i, j, k, comp) * vf_arr(i, j, k) * vol *
-                   static_cast<Real>(covered_arr(i, j, k));
-          });
-          return sum;
-        });
-    } else {
-      sm = amrex::ReduceSum(
-        *a_mf[lev], vfrac, 0,
-        [vol, comp] AMREX_GPU_HOST_DEVICE(
-          Box const& bx, Array4<Real const> const& mf_arr,
-          Array4<Real const> const& vf_arr) -> Real {
-          Real sum = 0.0;
-          AMREX_LOOP_3D(bx, i, j, k, {
-            sum += mf_arr(i, j, k, comp) * vf_arr(i, j, k) * vol;
-          });
-          return sum;
-        });
+  return volwgtsum;
+}
+
+Vector<Real>
+PeleLM::MFSum(const Vector<const MultiFab*>& a_mf, int scomp, int ncomp)
+{
+  BL_PROFILE("PeleLMeX::MFSum()");
+  // Get the integrals of ncomp components of a MF, not including the
+  // fine-covered and EB-covered cells, with a single parallel reduction
+  AMREX_ASSERT(a_mf[0]->nComp() >= scomp + ncomp);
+
+  Vector<Real> volwgtsum(ncomp, 0.0);
+
+  for (int lev = 0; lev <= finest_level; ++lev) {
+    auto levsum = MFSumLocal(*a_mf[lev], getVolumeWeights(lev), scomp, ncomp);
+    for (int n = 0; n < ncomp; ++n) {
+      volwgtsum[n] += levsum[n];
     }
-#else
-    // Get the geometry volume to account for 2D-RZ
-    MultiFab volume(grids[lev], dmap[lev], 1, 0);
-    geom[lev].GetVolume(volume);
+  }
 
-    Real sm = 0.0;
-    if (lev != finest_level) {
-      sm = amrex::ReduceSum(
-        *a_mf[lev], volume, *m_coveredMask[lev], 0,
-        [comp] AMREX_GPU_HOST_DEVICE(
-          Box const& bx, Array4<Real const> const& mf_arr,
-          Array4<Real const> const& vol_arr,
-          Array4<int const> const& covered_arr) -> Real {
-          Real sum = 0.0;
-          AMREX_LOOP_3D(bx, i, j, k, {
-            sum += mf_arr(i, j, k, comp) * vol_arr(i, j, k) *
-                   static_cast<Real>(covered_arr(i, j, k));
-          });
-          return sum;
-        });
-    } else {
-      sm = amrex::ReduceSum(
-        *a_mf[lev], volume, 0,
-        [comp] AMREX_GPU_HOST_DEVICE(
-          Box const& bx, Array4<Real const> const& mf_arr,
-          Array4<Real const> const& vol_arr) -> Real {
-          Real sum = 0.0;
-          AMREX_LOOP_3D(
-            bx, i, j, k, { sum += mf_arr(i, j, k, comp) * vol_arr(i, j, k); });
-          return sum;
+  ParallelDescriptor::ReduceRealSum(volwgtsum.data(), ncomp);
+
+  return volwgtsum;
+}
+
+// Weighted sum of ncomp components of a MultiFab, local
+Vector<Real>
+PeleLM::MFSumLocal(
+  const MultiFab& a_MF, const MultiFab& a_wgt, int scomp, int ncomp)
+{
+  Vector<Real> sm(ncomp, 0.0);
+
+#ifdef AMREX_USE_GPU
+  if (Gpu::inLaunchRegion()) {
+    auto const& ma = a_MF.const_arrays();
+    auto const& wma = a_wgt.const_arrays();
+    for (int n = 0; n < ncomp; ++n) {
+      const int comp = scomp + n;
+      auto r = ParReduce(
+        TypeList<ReduceOpSum>{}, TypeList<Real>{}, a_MF, IntVect(0),
+        [=] AMREX_GPU_DEVICE(
+          int box_no, int i, int j, int k) noexcept -> GpuTuple<Real> {
+          return ma[box_no](i, j, k, comp) * wma[box_no](i, j, k);
         });
+      sm[n] = amrex::get<0>(r);
     }
+  } else
 #endif
+  {
+    // Single sweep over the data for all the components
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    {
+      Vector<Real> sm_loc(ncomp, 0.0);
+      for (MFIter mfi(a_MF, true); mfi.isValid(); ++mfi) {
+        Box const& bx = mfi.tilebox();
+        auto const& a = a_MF.const_array(mfi, scomp);
+        auto const& w = a_wgt.const_array(mfi);
+        AMREX_LOOP_3D(bx, i, j, k, {
+          for (int n = 0; n < ncomp; ++n) {
+            sm_loc[n] += a(i, j, k, n) * w(i, j, k);
+          }
+        });
+      }
+#ifdef AMREX_USE_OMP
+#pragma omp critical(pelelmex_mfsumlocal)
+#endif
+      for (int n = 0; n < ncomp; ++n) {
+        sm[n] += sm_loc[n];
+      }
+    }
+  }
 
-    volwgtsum += sm;
-  } // lev
+  return sm;
+}
 
-  ParallelDescriptor::ReduceRealSum(volwgtsum);
+// Min and max of ncomp components of a MultiFab over the cells with a
+// positive volume weight (i.e. excluding EB-covered/fine-covered), local
+void
+PeleLM::MFminmaxLocal(
+  const MultiFab& a_MF,
+  const MultiFab& a_wgt,
+  int scomp,
+  int ncomp,
+  Vector<Real>& a_min,
+  Vector<Real>& a_max)
+{
+  AMREX_ASSERT(a_min.size() >= ncomp && a_max.size() >= ncomp);
 
-  return volwgtsum;
+#ifdef AMREX_USE_GPU
+  if (Gpu::inLaunchRegion()) {
+    auto const& ma = a_MF.const_arrays();
+    auto const& wma = a_wgt.const_arrays();
+    for (int n = 0; n < ncomp; ++n) {
+      const int comp = scomp + n;
+      auto r = ParReduce(
+        TypeList<ReduceOpMin, ReduceOpMax>{}, TypeList<Real, Real>{}, a_MF,
+        IntVect(0),
+        [=] AMREX_GPU_DEVICE(
+          int box_no, int i, int j, int k) noexcept -> GpuTuple<Real, Real> {
+          if (wma[box_no](i, j, k) > 0.0) {
+            return {ma[box_no](i, j, k, comp), ma[box_no](i, j, k, comp)};
+          }
+          return {AMREX_REAL_MAX, AMREX_REAL_LOWEST};
+        });
+      a_min[n] = std::min(a_min[n], amrex::get<0>(r));
+      a_max[n] = std::max(a_max[n], amrex::get<1>(r));
+    }
+  } else
+#endif
+  {
+    // Single sweep over the data for all the components
+#ifdef AMREX_USE_OMP
+#pragma omp parallel if (Gpu::notInLaunchRegion())
+#endif
+    {
+      Vector<Real> mn_loc(ncomp, AMREX_REAL_MAX);
+      Vector<Real> mx_loc(ncomp, AMREX_REAL_LOWEST);
+      for (MFIter mfi(a_MF, true); mfi.isValid(); ++mfi) {
+        Box const& bx = mfi.tilebox();
+        auto const& a = a_MF.const_array(mfi, scomp);
+        auto const& w = a_wgt.const_array(mfi);
+        AMREX_LOOP_3D(bx, i, j, k, {
+          if (w(i, j, k) > 0.0) {
+            for (int n = 0; n < ncomp; ++n) {
+              mn_loc[n] = std::min(mn_loc[n], a(i, j, k, n));
+              mx_loc[n] = std::max(mx_loc[n], a(i, j, k, n));
+            }
+          }
+        });
+      }
+#ifdef AMREX_USE_OMP
+#pragma omp critical(pelelmex_mfminmaxlocal)
+#endif
+      for (int n = 0; n < ncomp; ++n) {
+        a_min[n] = std::min(a_min[n], mn_loc[n]);
+        a_max[n] = std::max(a_max[n], mx_loc[n]);
+      }
+    }
+  }
 }
 
 /*
@@ -1344,14 +1607,11 @@ void
 PeleLM::setTypicalValues(const TimeStamp& a_time, int is_init)
 {
   // Get state Max/Min
-  auto stateMax =
-    (m_incompressible) != 0
-      ? MLmax(GetVecOfConstPtrs(getStateVect(a_time)), 0, AMREX_SPACEDIM)
-      : MLmax(GetVecOfConstPtrs(getStateVect(a_time)), 0, NVAR);
-  auto stateMin =
-    (m_incompressible) != 0
-      ? MLmin(GetVecOfConstPtrs(getStateVect(a_time)), 0, AMREX_SPACEDIM)
-      : MLmin(GetVecOfConstPtrs(getStateVect(a_time)), 0, NVAR);
+  Vector<Real> stateMax;
+  Vector<Real> stateMin;
+  MLminmax(
+    GetVecOfConstPtrs(getStateVect(a_time)), 0,
+    (m_incompressible) != 0 ? AMREX_SPACEDIM : NVAR, stateMin, stateMax);
 
   // Fill typical values vector
   for (int idim = 0; idim < AMREX_SPACEDIM; idim++) {
@@ -1612,29 +1872,46 @@ PeleLM::MFmin(const MultiFab* a_MF, const iMultiFab& a_mask, int comp)
   return mn;
 }
 
-// MultiLevel max, exlucing EB-covered/fine-covered cells
-Vector<Real>
-PeleLM::MLmax(const Vector<const MultiFab*>& a_MF, int scomp, int ncomp)
+// MultiLevel min and max, exlucing EB-covered/fine-covered cells
+void
+PeleLM::MLminmax(
+  const Vector<const MultiFab*>& a_MF,
+  int scomp,
+  int ncomp,
+  Vector<Real>& a_min,
+  Vector<Real>& a_max)
 {
-  BL_PROFILE("PeleLMeX::MLmax()");
+  BL_PROFILE("PeleLMeX::MLminmax()");
   AMREX_ASSERT(a_MF[0]->nComp() >= scomp + ncomp);
 
-  Vector<Real> nmax(ncomp, AMREX_REAL_LOWEST);
+  a_min.assign(ncomp, AMREX_REAL_MAX);
+  a_max.assign(ncomp, AMREX_REAL_LOWEST);
 
   for (int lev = 0; lev < a_MF.size(); ++lev) {
-    if (lev != finest_level) {
-      for (int n = 0; n < ncomp; n++) {
-        nmax[n] =
-          std::max(nmax[n], MFmax(a_MF[lev], *m_coveredMask[lev], scomp + n));
-      }
-    } else {
-      for (int n = 0; n < ncomp; n++) {
-        nmax[n] = std::max(nmax[n], a_MF[lev]->max(scomp + n, 0, true));
-      }
-    }
+    MFminmaxLocal(
+      *a_MF[lev], getVolumeWeights(lev), scomp, ncomp, a_min, a_max);
   }
 
-  ParallelDescriptor::ReduceRealMax(nmax.data(), ncomp);
+  // Single reduction: pack -max with min
+  Vector<Real> minNegMax(2 * ncomp);
+  for (int n = 0; n < ncomp; n++) {
+    minNegMax[n] = a_min[n];
+    minNegMax[ncomp + n] = -a_max[n];
+  }
+  ParallelDescriptor::ReduceRealMin(minNegMax.data(), 2 * ncomp);
+  for (int n = 0; n < ncomp; n++) {
+    a_min[n] = minNegMax[n];
+    a_max[n] = -minNegMax[ncomp + n];
+  }
+}
+
+// MultiLevel max, exlucing EB-covered/fine-covered cells
+Vector<Real>
+PeleLM::MLmax(const Vector<const MultiFab*>& a_MF, int scomp, int ncomp)
+{
+  Vector<Real> nmin;
+  Vector<Real> nmax;
+  MLminmax(a_MF, scomp, ncomp, nmin, nmax);
   return nmax;
 }
 
@@ -1642,25 +1919,9 @@ PeleLM::MLmax(const Vector<const MultiFab*>& a_MF, int scomp, int ncomp)
 Vector<Real>
 PeleLM::MLmin(const Vector<const MultiFab*>& a_MF, int scomp, int ncomp)
 {
-  BL_PROFILE("PeleLMeX::MLmin()");
-  AMREX_ASSERT(a_MF[0]->nComp() >= scomp + ncomp);
-
-  Vector<Real> nmin(ncomp, AMREX_REAL_MAX);
-
-  for (int lev = 0; lev < a_MF.size(); ++lev) {
-    if (lev != finest_level) {
-      for (int n = 0; n < ncomp; n++) {
-        nmin[n] =
-          std::min(nmin[n], MFmin(a_MF[lev], *m_coveredMask[lev], scomp + n));
-      }
-    } else {
-      for (int n = 0; n < ncomp; n++) {
-        nmin[n] = std::min(nmin[n], a_MF[lev]->min(scomp + n, 0, true));
-      }
-    }
-  }
-
-  ParallelDescriptor::ReduceRealMin(nmin.data(), ncomp);
+  Vector<Real> nmin;
+  Vector<Real> nmax;
+  MLminmax(a_MF, scomp, ncomp, nmin, nmax);
   return nmin;
 }
 
@@ -0,0 +1,64 @@
+import argparse
+import struct
+import numpy as np
+
+# Reader for the PeleLMeX in-run samplers output (peleLM.samplers),
+# e.g. samples/flamePlane.bin
+# Usage: python samples.py samples/flamePlane.bin
+
+MAGIC = b"PLMXSMP1"
+
+
+def read_samples(fname):
+    """Read a samples file.
+
+    Returns (names, coords, steps, times, values) with coords of shape
+    (npts, spacedim) and values of shape (nrecords, npts, nvars).
+    """
+    with open(fname, "rb") as f:
+        if f.read(8) != MAGIC:
+            raise ValueError(f"{fname} is not a PeleLMeX samples file")
+        spacedim, npts, nvars, nbytes = struct.unpack("<4i", f.read(16))
+        names = []
+        for _ in range(nvars):
+            (length,) = struct.unpack("<i", f.read(4))
+            names.append(f.read(length).decode())
+        coords = np.fromfile(f, dtype="<f8", count=npts * spacedim)
+        coords = coords.reshape(npts, spacedim)
+        dtype = "<f4" if nbytes == 4 else "<f8"
+        steps, times, values = [], [], []
+        while True:
+            raw = f.read(16)
+            if len(raw) < 16:
+                break
+            step, time = struct.unpack("<qd", raw)
+            data = np.fromfile(f, dtype=dtype, count=npts * nvars)
+            if data.size < npts * nvars:
+                break
+            steps.append(step)
+            times.append(time)
+            values.append(data.reshape(npts, nvars))
+    values = np.array(values) if values else np.empty((0, npts, nvars))
+    return names, coords, np.array(steps), np.array(times), values
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Summarize a PeleLMeX samples file")
+    parser.add_argument("file", help="Samples file (*.bin)")
+    args = parser.parse_args()
+    names, coords, steps, times, values = read_samples(args.file)
+    print(f"{coords.shape[0]} points, fields: {' '.join(names)}")
+    if steps.size > 0:
+        print(
+            f"{steps.size} records, steps {steps[0]} to {steps[-1]},"
+            f" time {times[0]} to {times[-1]}"
+        )
+        for v, name in enumerate(names):
+            print(
+                f"  {name}: last record min {np.nanmin(values[-1, :, v])}"
+                f" max {np.nanmax(values[-1, :, v])}"
+            )
+
+
+if __name__ == "__main__":
+    main()
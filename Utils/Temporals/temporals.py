@@ -0,0 +1,71 @@
+import argparse
+import struct
+import sys
+import numpy as np
+
+# Reader/converter for the PeleLMeX binary columnar temporals
+# (peleLM.temporal_format = binary), e.g. temporals/tempState.bin
+# Usage: python temporals.py temporals/tempState.bin [-o tempState.txt] [--csv]
+
+MAGIC = b"PLMXTMP1"
+
+
+def read_temporals(fname):
+    """Read a binary temporal file, return a dict {column name: array}"""
+    with open(fname, "rb") as f:
+        if f.read(8) != MAGIC:
+            raise ValueError(f"{fname} is not a PeleLMeX binary temporal file")
+        (ncols,) = struct.unpack("<i", f.read(4))
+        names = []
+        for _ in range(ncols):
+            (length,) = struct.unpack("<i", f.read(4))
+            names.append(f.read(length).decode())
+        chunks = []
+        while True:
+            raw = f.read(4)
+            if len(raw) < 4:
+                break
+            (nrows,) = struct.unpack("<i", raw)
+            data = np.fromfile(f, dtype="<f8", count=ncols * nrows)
+            if data.size < ncols * nrows:
+                print(f"Warning: truncated chunk in {fname}", file=sys.stderr)
+                break
+            chunks.append(data.reshape(ncols, nrows))
+    data = np.hstack(chunks) if chunks else np.empty((ncols, 0))
+    return {name: data[c] for c, name in enumerate(names)}
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Convert a PeleLMeX binary temporal file to ASCII"
+    )
+    parser.add_argument("file", help="Binary temporal file (*.bin)")
+    parser.add_argument(
+        "-o", "--output", default=None, help="Output file (default: stdout)"
+    )
+    parser.add_argument(
+        "--csv", action="store_true", help="Comma separated output with header"
+    )
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    columns = read_temporals(args.file)
+    names = list(columns.keys())
+    table = np.column_stack([columns[n] for n in names])
+    delimiter = "," if args.csv else " "
+    header = delimiter.join(names)
+    out = args.output if args.output is not None else sys.stdout
+    np.savetxt(
+        out,
+        table,
+        fmt="%.12g",
+        delimiter=delimiter,
+        header=header,
+        comments="" if args.csv else "# ",
+    )
+
+
+if __name__ == "__main__":
+    main()